@@ -5,9 +5,11 @@ SUBDIRS             += \
     data                                \
     demo                                \
     style                               \
+    tests                               \
 
 
 style.depends = lib
+tests.depends = lib
 
 
 OTHER_FILES         += \
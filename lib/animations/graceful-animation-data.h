@@ -7,6 +7,7 @@
 
 #include "graceful-export.h"
 #include "graceful-animation.h"
+#include "graceful-frame-clock.h"
 
 
 namespace Graceful
@@ -64,8 +65,16 @@ public:
     static const qreal OpacityInvalid;
 
 protected:
-    //* setup animation
-    virtual void setupAnimation(const Animation::Pointer &animation, const QByteArray &property);
+    //* setup animation, writing its value with given setter
+    virtual void setupAnimation(const Animation::Pointer &animation, const Animation::Setter &setter);
+
+    //* setup animation, writing its value with given qreal setter of the derived class
+    template<typename T>
+    void setupAnimation(const Animation::Pointer &animation, void (T::*setter)(qreal))
+    {
+
+        setupAnimation(animation, Animation::Setter(std::bind(setter, static_cast<T *>(this), std::placeholders::_1)));
+    }
 
     //* apply step
     virtual qreal digitize(const qreal &value) const
@@ -78,12 +87,21 @@ protected:
         }
     }
 
-    //* trigger target update
+    //* trigger target update, merged with other updates of the same frame
     virtual void setDirty() const
     {
 
         if (_target) {
-            _target.data()->update();
+            FrameClock::instance().update(_target.data());
+        }
+    }
+
+    //* trigger update of given rect of the target. An empty rect updates the whole target
+    void setDirty(const QRect &rect) const
+    {
+
+        if (_target) {
+            FrameClock::instance().update(_target.data(), rect);
         }
     }
 
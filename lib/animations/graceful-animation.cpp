@@ -1 +1,112 @@
 #include "graceful-animation.h"
+#include "graceful-frame-clock.h"
+
+namespace Graceful
+{
+
+//____________________________________________________________
+Animation::Animation(int duration, QObject *parent)
+    : QObject(parent)
+    , _duration(qMax(0, duration))
+    , _direction(Forward)
+    , _state(Stopped)
+    , _startValue(0)
+    , _endValue(1)
+    , _loopCount(1)
+    , _currentLoop(0)
+    , _currentTime(0)
+    , _lastTick(0)
+{
+}
+
+//____________________________________________________________
+Animation::~Animation()
+{
+
+    if (isRunning()) {
+        FrameClock::instance().unregisterAnimation(this);
+    }
+}
+
+//____________________________________________________________
+void Animation::start()
+{
+
+    if (isRunning()) {
+        return;
+    }
+
+    _state = Running;
+    _currentLoop = 0;
+    _lastTick = FrameClock::instance().registerAnimation(this);
+
+    // write initial value right away. Zero duration animations finish here
+    setCurrentTime(_direction == Forward ? 0 : _duration);
+}
+
+//____________________________________________________________
+void Animation::stop()
+{
+
+    if (!isRunning()) {
+        return;
+    }
+
+    _state = Stopped;
+    FrameClock::instance().unregisterAnimation(this);
+}
+
+//____________________________________________________________
+void Animation::advance(qint64 now)
+{
+
+    const qint64 elapsed(now - _lastTick);
+    _lastTick = now;
+    setCurrentTime(_direction == Forward ? _currentTime + elapsed : _currentTime - elapsed);
+}
+
+//____________________________________________________________
+void Animation::setCurrentTime(qint64 time)
+{
+
+    bool done(false);
+    if (_direction == Forward && time >= _duration) {
+        if (_duration > 0 && (_loopCount < 0 || ++_currentLoop < _loopCount)) {
+            time %= _duration;
+        } else {
+            time = _duration;
+            done = true;
+        }
+
+    } else if (_direction == Backward && time <= 0) {
+        if (_duration > 0 && (_loopCount < 0 || ++_currentLoop < _loopCount)) {
+            time = _duration - (-time) % _duration;
+        } else {
+            time = 0;
+            done = true;
+        }
+    }
+
+    _currentTime = time;
+    updateValue();
+
+    if (done) {
+        stop();
+        Q_EMIT finished();
+    }
+}
+
+//____________________________________________________________
+void Animation::updateValue()
+{
+
+    if (!_target || !_setter) {
+        return;
+    }
+
+    // same convention as QVariantAnimation: zero duration animations sit at their end value
+    const qreal progress(_duration > 0 ? qreal(_currentTime) / _duration : 1.0);
+    _setter(_startValue + (_endValue - _startValue) * progress);
+}
+
+}
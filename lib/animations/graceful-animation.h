@@ -4,27 +4,65 @@
 #include "graceful.h"
 #include "graceful-export.h"
 
-#include <QVariant>
-#include <QPropertyAnimation>
+#include <QObject>
+
+#include <functional>
 
 namespace Graceful
 {
-class GRACEFUL_EXPORT Animation : public QPropertyAnimation
+/**
+ * linear animation of a qreal value, written to its target through a typed setter.
+ * Provides the subset of QPropertyAnimation used by the animation engines.
+ * Running animations are advanced by FrameClock, all together, once per frame
+ */
+class GRACEFUL_EXPORT Animation : public QObject
 {
     Q_OBJECT
 public:
     //* convenience
     using Pointer = WeakPointer<Animation>;
 
+    //* writes the current value to the target
+    using Setter = std::function<void(qreal)>;
+
+    //* direction
+    enum Direction {
+        Forward,
+        Backward
+    };
+
+    //* state
+    enum State {
+        Stopped,
+        Running
+    };
+
     //* constructor
-    Animation(int duration, QObject *parent) : QPropertyAnimation(parent)
+    Animation(int duration, QObject *parent);
+
+    //* destructor
+    virtual ~Animation();
+
+    //*@name accessors
+    //@{
+
+    //* duration, in milliseconds
+    int duration() const
     {
+        return _duration;
+    }
 
-        setDuration(duration);
+    //* direction
+    Direction direction() const
+    {
+        return _direction;
     }
 
-    //* destructor
-    virtual ~Animation() = default;
+    //* state
+    State state() const
+    {
+        return _state;
+    }
 
     //* true if running
     bool isRunning() const
@@ -33,6 +71,57 @@ public:
         return state() == Animation::Running;
     }
 
+    //@}
+
+    //*@name modifiers
+    //@{
+
+    //* duration, in milliseconds
+    void setDuration(int value)
+    {
+        _duration = qMax(0, value);
+    }
+
+    //* direction. Takes effect immediately if running
+    void setDirection(Direction value)
+    {
+        _direction = value;
+    }
+
+    //* value written at the start of a forward animation
+    void setStartValue(qreal value)
+    {
+        _startValue = value;
+    }
+
+    //* value written at the end of a forward animation
+    void setEndValue(qreal value)
+    {
+        _endValue = value;
+    }
+
+    //* number of loops. -1 loops until stopped
+    void setLoopCount(int value)
+    {
+        _loopCount = value;
+    }
+
+    //* animated object, and setter called with the current value on every frame
+    void setTarget(QObject *target, const Setter &setter)
+    {
+        _target = target;
+        _setter = setter;
+    }
+
+    //* animated object, and one of its qreal setters
+    template<typename T>
+    void setTarget(T *target, void (T::*setter)(qreal))
+    {
+        setTarget(target, Setter(std::bind(setter, target, std::placeholders::_1)));
+    }
+
+    //@}
+
     void restart()
     {
 
@@ -42,6 +131,58 @@ public:
 
         start();
     }
+
+public Q_SLOTS:
+    //* start from the beginning, or from the end when going backward. Does nothing if already running
+    void start();
+
+    //* stop, without emitting finished
+    void stop();
+
+Q_SIGNALS:
+    //* emitted when the animation reaches its end
+    void finished();
+
+private:
+    //* advance to given clock time. Called by FrameClock
+    void advance(qint64 now);
+
+    //* move to given time, looping or finishing as needed
+    void setCurrentTime(qint64 time);
+
+    //* write value matching current time
+    void updateValue();
+
+    //* duration
+    int _duration;
+
+    //* direction
+    Direction _direction;
+
+    //* state
+    State _state;
+
+    //* values
+    qreal _startValue;
+    qreal _endValue;
+
+    //* loops
+    int _loopCount;
+    int _currentLoop;
+
+    //* current time, in milliseconds, between 0 and duration
+    qint64 _currentTime;
+
+    //* clock time of the last advance
+    qint64 _lastTick;
+
+    //* target
+    WeakPointer<QObject> _target;
+
+    //* setter
+    Setter _setter;
+
+    friend class FrameClock;
 };
 
 }
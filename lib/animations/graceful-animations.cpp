@@ -20,16 +20,13 @@ namespace Graceful
 Animations::Animations(QObject *parent) : QObject(parent)
 {
 
-    _widgetEnabilityEngine = new WidgetStateEngine(this);
+    _widgetStateEngine = new WidgetStateEngine(this);
+    _inputWidgetEngine = new WidgetStateEngine(this);
     _busyIndicatorEngine = new BusyIndicatorEngine(this);
-    _comboBoxEngine = new WidgetStateEngine(this);
-    _toolButtonEngine = new WidgetStateEngine(this);
     _spinBoxEngine = new SpinBoxEngine(this);
     _toolBoxEngine = new ToolBoxEngine(this);
 
     registerEngine(_headerViewEngine = new HeaderViewEngine(this));
-    registerEngine(_widgetStateEngine = new WidgetStateEngine(this));
-    registerEngine(_inputWidgetEngine = new WidgetStateEngine(this));
     registerEngine(_scrollBarEngine = new ScrollBarEngine(this));
     registerEngine(_stackedWidgetEngine = new StackedWidgetEngine(this));
     registerEngine(_tabBarEngine = new TabBarEngine(this));
@@ -45,15 +42,13 @@ void Animations::setupEngines()
     bool animationsEnabled(Graceful::Config::AnimationsEnabled);
     int animationsDuration(Graceful::Config::AnimationsDuration);
 
-    _widgetEnabilityEngine->setEnabled(animationsEnabled);
-    _comboBoxEngine->setEnabled(animationsEnabled);
-    _toolButtonEngine->setEnabled(animationsEnabled);
+    _widgetStateEngine->setEnabled(animationsEnabled);
+    _inputWidgetEngine->setEnabled(animationsEnabled);
     _spinBoxEngine->setEnabled(animationsEnabled);
     _toolBoxEngine->setEnabled(animationsEnabled);
 
-    _widgetEnabilityEngine->setDuration(animationsDuration);
-    _comboBoxEngine->setDuration(animationsDuration);
-    _toolButtonEngine->setDuration(animationsDuration);
+    _widgetStateEngine->setDuration(animationsDuration);
+    _inputWidgetEngine->setDuration(animationsDuration);
     _spinBoxEngine->setDuration(animationsDuration);
     _stackedWidgetEngine->setDuration(animationsDuration);
     _toolBoxEngine->setDuration(animationsDuration);
@@ -84,35 +79,36 @@ void Animations::registerWidget(QWidget *widget) const
         return;
     }
 
-    // all widgets are registered to the enability engine.
-    _widgetEnabilityEngine->registerWidget(widget, AnimationEnable);
+    // all widgets are registered for enability.
+    // Other modes are collected so that each engine stores a single record per widget
+    AnimationModes modes(AnimationEnable);
+    AnimationModes inputModes(AnimationNone);
 
     // install animation timers
     // for optimization, one should put with most used widgets here first
 
     // buttons
     if (qobject_cast<QToolButton *>(widget)) {
-        _toolButtonEngine->registerWidget(widget, AnimationHover | AnimationPressed);
-        _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationPressed);
+        modes |= AnimationHover | AnimationPressed | AnimationSubControlHover;
     } else if (qobject_cast<QCheckBox *>(widget) || qobject_cast<QRadioButton *>(widget)) {
-        _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationFocus | AnimationPressed);
+        modes |= AnimationHover | AnimationFocus | AnimationPressed;
     } else if (qobject_cast<QAbstractButton *>(widget)) {
         // register to toolbox engine if needed
         if (qobject_cast<QToolBox *>(widget->parent())) {
             _toolBoxEngine->registerWidget(widget);
         }
 
-        _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationPressed);
+        modes |= AnimationHover | AnimationPressed;
     // groupboxes
     } else if (QGroupBox *groupBox = qobject_cast<QGroupBox *>(widget)) {
         if (groupBox->isCheckable()) {
-            _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+            modes |= AnimationHover | AnimationFocus;
         }
     // sliders
     } else if (qobject_cast<QScrollBar *>(widget)) {
         _scrollBarEngine->registerWidget(widget, AnimationHover | AnimationFocus);
     } else if (qobject_cast<QSlider *>(widget)) {
-        _widgetStateEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+        modes |= AnimationHover | AnimationFocus;
     } else if (qobject_cast<QDial *>(widget)) {
         _dialEngine->registerWidget(widget, AnimationHover | AnimationFocus);
     // progress bar
@@ -120,36 +116,40 @@ void Animations::registerWidget(QWidget *widget) const
         _busyIndicatorEngine->registerWidget(widget);
     // combo box
     } else if (qobject_cast<QComboBox *>(widget)) {
-        _comboBoxEngine->registerWidget(widget, AnimationHover | AnimationPressed);
-        _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus | AnimationPressed);
+        inputModes |= AnimationHover | AnimationFocus | AnimationPressed;
     // spinbox
     } else if (qobject_cast<QAbstractSpinBox *>(widget)) {
         _spinBoxEngine->registerWidget(widget);
-        _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus | AnimationPressed);
+        inputModes |= AnimationHover | AnimationFocus | AnimationPressed;
     // editors
     } else if (qobject_cast<QLineEdit *>(widget)) {
-        _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+        inputModes |= AnimationHover | AnimationFocus;
     } else if (qobject_cast<QTextEdit *>(widget)) {
-        _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+        inputModes |= AnimationHover | AnimationFocus;
     } else if (widget->inherits("KTextEditor::View")) {
-        _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+        inputModes |= AnimationHover | AnimationFocus;
     // header views
     // need to come before abstract item view, otherwise is skipped
     } else if (qobject_cast<QHeaderView *>(widget)) {
         _headerViewEngine->registerWidget(widget);
     // lists
     } else if (qobject_cast<QAbstractItemView *>(widget)) {
-        _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+        inputModes |= AnimationHover | AnimationFocus;
     // tabbar
     } else if (qobject_cast<QTabBar *>(widget)) {
         _tabBarEngine->registerWidget(widget);
     // scrollarea
     } else if (QAbstractScrollArea *scrollArea = qobject_cast<QAbstractScrollArea *>(widget)) {
         if (scrollArea->frameShadow() == QFrame::Sunken && (widget->focusPolicy()&Qt::StrongFocus)) {
-            _inputWidgetEngine->registerWidget(widget, AnimationHover | AnimationFocus);
+            inputModes |= AnimationHover | AnimationFocus;
         }
     }
 
+    _widgetStateEngine->registerWidget(widget, modes);
+    if (inputModes) {
+        _inputWidgetEngine->registerWidget(widget, inputModes);
+    }
+
     // stacked widgets
     if (QStackedWidget *stack = qobject_cast<QStackedWidget *>(widget)) {
         _stackedWidgetEngine->registerWidget(stack);
@@ -165,10 +165,10 @@ void Animations::unregisterWidget(QWidget *widget) const
         return;
     }
 
-    _widgetEnabilityEngine->unregisterWidget(widget);
+    _widgetStateEngine->unregisterWidget(widget);
+    _inputWidgetEngine->unregisterWidget(widget);
     _spinBoxEngine->unregisterWidget(widget);
-    _comboBoxEngine->unregisterWidget(widget);
-    _busyIndicatorEngine->registerWidget(widget);
+    _busyIndicatorEngine->unregisterWidget(widget);
 
     // the following allows some optimization of widget unregistration
     // it assumes that a widget can be registered atmost in one of the
@@ -37,35 +37,22 @@ public:
     /** unregister all animations associated to a widget */
     void unregisterWidget(QWidget *widget) const;
 
-    //* enability engine
-    WidgetStateEngine &widgetEnabilityEngine() const
-    {
-
-        return *_widgetEnabilityEngine;
-    }
-
-    //* abstractButton engine
+    /**
+     * widget state engine.
+     * Holds the hover, focus, enable, pressed and sub-control hover animations of buttons,
+     * and the enable animation of all registered widgets, in a single record per widget
+     */
     WidgetStateEngine &widgetStateEngine() const
     {
 
         return *_widgetStateEngine;
     }
 
-    //* editable combobox arrow hover engine
-    WidgetStateEngine &comboBoxEngine() const
-    {
-
-        return *_comboBoxEngine;
-    }
-
-    //! Tool buttons arrow hover engine
-    WidgetStateEngine &toolButtonEngine() const
-    {
-
-        return *_toolButtonEngine;
-    }
-
-    //! item view engine
+    /**
+     * input widget engine.
+     * Editors, item views and scroll areas are also passed to the paint path for the
+     * buttons and indicators drawn inside them, so their frame animations are kept apart
+     */
     WidgetStateEngine &inputWidgetEngine() const
     {
 
@@ -139,19 +126,10 @@ private:
     //* headerview hover effect
     HeaderViewEngine *_headerViewEngine;
 
-    //* widget enability engine
-    WidgetStateEngine *_widgetEnabilityEngine;
-
-    //* abstract button engine
+    //* widget state engine
     WidgetStateEngine *_widgetStateEngine;
 
-    //* editable combobox arrow hover effect
-    WidgetStateEngine *_comboBoxEngine;
-
-    //! mennu toolbutton arrow hover effect
-    WidgetStateEngine *_toolButtonEngine;
-
-    //! item view engine
+    //* input widget engine
     WidgetStateEngine *_inputWidgetEngine;
 
     //* scrollbar engine
@@ -70,8 +70,10 @@ void BusyIndicatorEngine::setAnimated(const QObject *object, bool value)
                 // setup
                 _animation.data()->setStartValue(0.0);
                 _animation.data()->setEndValue(100.0);
-                _animation.data()->setTargetObject(this);
-                _animation.data()->setPropertyName("value");
+                // value is an int. Round as the property conversion did
+                _animation.data()->setTarget(this, [this](qreal value) {
+                    setValue(qRound(value));
+                });
                 _animation.data()->setLoopCount(-1);
                 _animation.data()->setDuration(duration() * 3);
             }
@@ -1,7 +1,7 @@
 #ifndef GRACEFUL_DATAMAP_H
 #define GRACEFUL_DATAMAP_H
 
-#include <QMap>
+#include <QVector>
 #include <QObject>
 #include <QPaintDevice>
 
@@ -11,15 +11,147 @@
 
 namespace Graceful
 {
+/**
+ * plain pointer to data stored in a data map, with the accessors of WeakPointer.
+ * Unlike WeakPointer, copies do not touch a shared reference count.
+ * Maps clear stored pointers when their data is destroyed
+ */
+template<typename T> class DataPointer
+{
+public:
+    //* constructor
+    DataPointer(T *value = nullptr) : _value(value)
+    {
+    }
+
+    //* data
+    T *data() const
+    {
+        return _value;
+    }
+
+    T *operator->() const
+    {
+        return _value;
+    }
+
+    //* true if not null
+    explicit operator bool() const
+    {
+        return _value;
+    }
+
+    //* reset to null
+    void clear()
+    {
+        _value = nullptr;
+    }
+
+private:
+    //* data
+    T *_value;
+};
+
 //* data map
-/** it maps templatized data object to associated object */
-template<typename K, typename T> class GRACEFUL_EXPORT BaseDataMap : public QMap<const K *, WeakPointer<T>>
+/**
+ * it maps templatized data object to associated object.
+ * Entries are stored in a flat, open addressing table with linear probing.
+ * Removal shifts following entries back, so that no tombstones are left.
+ * Values are plain pointers, cleared from the destroyed() signal of their data
+ */
+template<typename K, typename T> class GRACEFUL_EXPORT BaseDataMap
 {
 public:
     using Key = const K *;
-    using Value = WeakPointer<T>;
+    using Value = DataPointer<T>;
+
+    //* table slot. Empty slots have a null key
+    struct Entry {
+        Entry() : key(NULL)
+        {
+        }
+
+        Key key;
+        Value value;
+
+        //* connection to the destroyed() signal of value
+        QMetaObject::Connection connection;
+    };
+
+    //* iterator over occupied slots
+    template<typename E, typename V> class Iterator
+    {
+    public:
+        //* constructor
+        Iterator(E *entry, E *end) : _entry(entry), _end(end)
+        {
+            skipEmpty();
+        }
+
+        //* key
+        Key key() const
+        {
+            return _entry->key;
+        }
+
+        //* value
+        V &value() const
+        {
+            return _entry->value;
+        }
+
+        //*@name operators
+        //@{
+
+        V &operator*() const
+        {
+            return _entry->value;
+        }
+
+        V *operator->() const
+        {
+            return &_entry->value;
+        }
+
+        Iterator &operator++()
+        {
+            ++_entry;
+            skipEmpty();
+            return *this;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return _entry == other._entry;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return _entry != other._entry;
+        }
+
+        //@}
+
+    private:
+        //* move to next occupied slot
+        void skipEmpty()
+        {
+            while (_entry != _end && !_entry->key) {
+                ++_entry;
+            }
+        }
 
-    BaseDataMap() : QMap<Key, Value>(), _enabled(true), _lastKey(NULL)
+        //* current slot
+        E *_entry;
+
+        //* end of table
+        E *_end;
+    };
+
+    using iterator = Iterator<Entry, Value>;
+    using const_iterator = Iterator<const Entry, const Value>;
+
+    BaseDataMap() : _size(0), _bits(0), _enabled(true), _lastKey(NULL)
     {
 
     }
@@ -28,16 +160,49 @@ public:
     virtual ~BaseDataMap()
     {
 
+        // values may outlive the map
+        for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter) {
+            if (iter->key) {
+                QObject::disconnect(iter->connection);
+            }
+        }
     }
 
     //* insertion
-    virtual typename QMap<Key, Value>::iterator insert(const Key &key, const Value &value, bool enabled = true)
+    virtual void insert(const Key &key, const Value &value, bool enabled = true)
     {
 
+        if (!key) {
+            return;
+        }
+
         if (value) {
             value.data()->setEnabled(enabled);
         }
-        return QMap<Key, Value>::insert(key, value);
+
+        // a previous lookup may have cached a missing value
+        if (key == _lastKey) {
+            _lastKey = NULL;
+            _lastValue.clear();
+        }
+
+        // keep load factor at or below one half
+        if (2 * (_size + 1) > _entries.size()) {
+            rehash(_bits ? _bits + 1 : 4);
+        }
+
+        Entry &entry(_entries[slot(key)]);
+        if (!entry.key) {
+            entry.key = key;
+            ++_size;
+        } else {
+            QObject::disconnect(entry.connection);
+        }
+
+        entry.value = value;
+        entry.connection = value ? QObject::connect(value.data(), &QObject::destroyed, [this, key](QObject * object) {
+            valueDestroyed(key, object);
+        }) : QMetaObject::Connection();
     }
 
     //* find value
@@ -51,9 +216,11 @@ public:
             return _lastValue;
         } else {
             Value out;
-            typename QMap<Key, Value>::iterator iter(QMap<Key, Value>::find(key));
-            if (iter != QMap<Key, Value>::end()) {
-                out = iter.value();
+            if (_size) {
+                const Entry &entry(_entries.at(slot(key)));
+                if (entry.key) {
+                    out = entry.value;
+                }
             }
             _lastKey = key;
             _lastValue = out;
@@ -61,6 +228,50 @@ public:
         }
     }
 
+    //* true if key is registered
+    bool contains(Key key) const
+    {
+
+        return key && _size && _entries.at(slot(key)).key;
+    }
+
+    //* number of entries
+    int size() const
+    {
+        return _size;
+    }
+
+    //* true if empty
+    bool isEmpty() const
+    {
+        return !_size;
+    }
+
+    //*@name iterators
+    //@{
+
+    iterator begin()
+    {
+        return iterator(_entries.data(), _entries.data() + _entries.size());
+    }
+
+    iterator end()
+    {
+        return iterator(_entries.data() + _entries.size(), _entries.data() + _entries.size());
+    }
+
+    const_iterator constBegin() const
+    {
+        return const_iterator(_entries.constData(), _entries.constData() + _entries.size());
+    }
+
+    const_iterator constEnd() const
+    {
+        return const_iterator(_entries.constData() + _entries.size(), _entries.constData() + _entries.size());
+    }
+
+    //@}
+
     //* unregister widget
     bool unregisterWidget(Key key)
     {
@@ -78,17 +289,34 @@ public:
             _lastKey = NULL;
         }
 
-        // find key in map
-        typename QMap<Key, Value>::iterator iter(QMap<Key, Value>::find(key));
-        if (iter == QMap<Key, Value>::end()) {
+        // find key in table
+        if (!_size) {
+            return false;
+        }
+
+        int index(slot(key));
+        if (!_entries.at(index).key) {
             return false;
         }
 
         // delete value from map if found
-        if (iter.value()) {
-            iter.value().data()->deleteLater();
+        QObject::disconnect(_entries.at(index).connection);
+        if (_entries.at(index).value) {
+            _entries.at(index).value.data()->deleteLater();
         }
-        QMap<Key, Value>::erase(iter);
+
+        // shift back following entries that would otherwise become unreachable
+        const int mask(_entries.size() - 1);
+        for (int next = (index + 1) & mask; _entries.at(next).key; next = (next + 1) & mask) {
+            const int home(ideal(_entries.at(next).key));
+            if (((next - home) & mask) >= ((next - index) & mask)) {
+                _entries[index] = _entries.at(next);
+                index = next;
+            }
+        }
+
+        _entries[index] = Entry();
+        --_size;
 
         return true;
     }
@@ -124,6 +352,68 @@ public:
     }
 
 private:
+    Q_DISABLE_COPY(BaseDataMap)
+
+    //* clear value of given key, if still the destroyed data
+    void valueDestroyed(Key key, QObject *object)
+    {
+
+        if (_lastValue && static_cast<QObject *>(_lastValue.data()) == object) {
+            _lastValue.clear();
+        }
+
+        if (!_size) {
+            return;
+        }
+
+        Entry &entry(_entries[slot(key)]);
+        if (entry.key == key && entry.value && static_cast<QObject *>(entry.value.data()) == object) {
+            entry.value.clear();
+            entry.connection = QMetaObject::Connection();
+        }
+    }
+
+    //* preferred slot of a key. Fibonacci hashing spreads aligned pointers over the table
+    int ideal(Key key) const
+    {
+        return int((quint64(quintptr(key)) * Q_UINT64_C(0x9E3779B97F4A7C15)) >> (64 - _bits));
+    }
+
+    //* slot holding key, or empty slot where it would be inserted
+    int slot(Key key) const
+    {
+        const int mask(_entries.size() - 1);
+        int index(ideal(key));
+        while (_entries.at(index).key && _entries.at(index).key != key) {
+            index = (index + 1) & mask;
+        }
+
+        return index;
+    }
+
+    //* resize table to 2^bits slots
+    void rehash(int bits)
+    {
+        QVector<Entry> entries(1 << bits);
+        entries.swap(_entries);
+        _bits = bits;
+
+        for (typename QVector<Entry>::const_iterator iter = entries.constBegin(); iter != entries.constEnd(); ++iter) {
+            if (iter->key) {
+                _entries[slot(iter->key)] = *iter;
+            }
+        }
+    }
+
+    //* slots
+    QVector<Entry> _entries;
+
+    //* number of occupied slots
+    int _size;
+
+    //* log2 of the number of slots
+    int _bits;
+
     //* enability
     bool _enabled;
 
@@ -14,17 +14,12 @@ bool DialEngine::registerWidget(QWidget *widget, AnimationModes mode)
     }
 
     // only handle hover and focus
-    if (mode & AnimationHover && !dataMap(AnimationHover).contains(widget)) {
-        dataMap(AnimationHover).insert(widget, new DialData(this, widget, duration()), enabled());
+    if (mode & AnimationHover && !hasData(widget, AnimationHover)) {
+        setData(widget, AnimationHover, new DialData(this, widget, duration()));
     }
-    if (mode & AnimationFocus && !dataMap(AnimationFocus).contains(widget)) {
-        dataMap(AnimationFocus).insert(widget, new WidgetStateData(this, widget, duration()), enabled());
-    }
-
-    // connect destruction signal
-    connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(unregisterWidget(QObject *)), Qt::UniqueConnection);
 
-    return true;
+    // focus data is created on first change
+    return WidgetStateEngine::registerWidget(widget, mode & AnimationFocus);
 }
 
 }
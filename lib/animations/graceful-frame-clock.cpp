@@ -0,0 +1,133 @@
+#include "graceful-frame-clock.h"
+#include "graceful-animation.h"
+
+#include <QTimerEvent>
+
+namespace Graceful
+{
+
+//____________________________________________________________
+FrameClock &FrameClock::instance()
+{
+    static FrameClock clock;
+    return clock;
+}
+
+//____________________________________________________________
+FrameClock::FrameClock()
+    : _advancing(false)
+{
+    _elapsed.start();
+}
+
+//____________________________________________________________
+qint64 FrameClock::registerAnimation(Animation *animation)
+{
+
+    if (!_animations.contains(animation)) {
+        _animations.append(animation);
+    }
+
+    if (!_timer.isActive()) {
+        _timer.start(Config::AnimationFrameInterval, Qt::PreciseTimer, this);
+    }
+
+    return now();
+}
+
+//____________________________________________________________
+void FrameClock::unregisterAnimation(Animation *animation)
+{
+
+    const int index(_animations.indexOf(animation));
+    if (index < 0) {
+        return;
+    }
+
+    // keep indices stable while advancing
+    if (_advancing) {
+        _animations[index] = nullptr;
+    } else {
+        _animations.remove(index);
+    }
+
+    if (_animations.isEmpty()) {
+        _timer.stop();
+    }
+}
+
+//____________________________________________________________
+void FrameClock::update(QWidget *widget, const QRect &rect)
+{
+
+    if (!widget) {
+        return;
+    }
+
+    if (!_advancing) {
+        if (rect.isEmpty()) {
+            widget->update();
+        } else {
+            widget->update(rect);
+        }
+
+        return;
+    }
+
+    // merge with pending repaint of same widget
+    const QRect damage(rect.isEmpty() ? widget->rect() : rect);
+    for (QVector<Damage>::iterator iter = _damages.begin(); iter != _damages.end(); ++iter) {
+        if (iter->widget.data() == widget) {
+            iter->rect |= damage;
+            return;
+        }
+    }
+
+    Damage pending = { widget, damage };
+    _damages.append(pending);
+}
+
+//____________________________________________________________
+void FrameClock::timerEvent(QTimerEvent *event)
+{
+
+    if (event->timerId() != _timer.timerId()) {
+        return QObject::timerEvent(event);
+    }
+
+    advance(now());
+}
+
+//____________________________________________________________
+void FrameClock::advance(qint64 time)
+{
+
+    // animations started during this frame are advanced from the next one
+    const int count(_animations.size());
+
+    _advancing = true;
+    for (int i = 0; i < count; ++i) {
+        if (Animation *animation = _animations[i]) {
+            animation->advance(time);
+        }
+    }
+
+    _advancing = false;
+    _animations.removeAll(nullptr);
+
+    // send merged repaints
+    QVector<Damage> damages;
+    damages.swap(_damages);
+    for (QVector<Damage>::const_iterator iter = damages.constBegin(); iter != damages.constEnd(); ++iter) {
+        if (iter->widget) {
+            iter->widget.data()->update(iter->rect);
+        }
+    }
+
+    // go idle
+    if (_animations.isEmpty()) {
+        _timer.stop();
+    }
+}
+
+}
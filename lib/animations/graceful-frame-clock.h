@@ -0,0 +1,97 @@
+#ifndef GRACEFUL_FRAME_CLOCK_H
+#define GRACEFUL_FRAME_CLOCK_H
+
+#include "graceful.h"
+#include "graceful-export.h"
+
+#include <QRect>
+#include <QObject>
+#include <QVector>
+#include <QWidget>
+#include <QBasicTimer>
+#include <QElapsedTimer>
+
+namespace Graceful
+{
+class Animation;
+
+/**
+ * single clock driving all running animations.
+ * Animations are advanced together, once per frame, and the repaints they
+ * trigger are merged and sent once per widget at the end of the frame.
+ * The timer only runs while at least one animation does
+ */
+class GRACEFUL_EXPORT FrameClock : public QObject
+{
+    Q_OBJECT
+public:
+    //* shared instance
+    static FrameClock &instance();
+
+    //* destructor
+    virtual ~FrameClock()
+    {
+    }
+
+    //* current clock time, in milliseconds
+    qint64 now() const
+    {
+        return _elapsed.elapsed();
+    }
+
+    //* true while animations are running
+    bool isActive() const
+    {
+        return _timer.isActive();
+    }
+
+    //* add running animation. Returns current clock time
+    qint64 registerAnimation(Animation *);
+
+    //* remove animation
+    void unregisterAnimation(Animation *);
+
+    /**
+     * repaint given rect of widget, or all of it if rect is empty.
+     * Requests made while advancing animations are merged and sent at the end of the frame
+     */
+    void update(QWidget *, const QRect &rect = QRect());
+
+    //* advance running animations to given clock time, and send merged repaints. Called by the timer once per frame
+    void advance(qint64 time);
+
+protected:
+    //* advance animations
+    virtual void timerEvent(QTimerEvent *) override;
+
+private:
+    //* constructor
+    FrameClock();
+
+    Q_DISABLE_COPY(FrameClock)
+
+    //* pending repaint
+    struct Damage {
+        WeakPointer<QWidget> widget;
+        QRect rect;
+    };
+
+    //* timer
+    QBasicTimer _timer;
+
+    //* time reference
+    QElapsedTimer _elapsed;
+
+    //* running animations. Entries removed while advancing are cleared, and dropped at the end of the frame
+    QVector<Animation *> _animations;
+
+    //* pending repaints
+    QVector<Damage> _damages;
+
+    //* true while advancing animations
+    bool _advancing;
+};
+
+}
+
+#endif
@@ -8,7 +8,7 @@ namespace Graceful
 GenericData::GenericData(QObject *parent, QWidget *target, int duration) : AnimationData(parent, target), _animation(new Animation(duration, this)), _opacity(0)
 {
 
-    setupAnimation(_animation, "opacity");
+    setupAnimation(_animation, &GenericData::setOpacity);
 }
 
 }
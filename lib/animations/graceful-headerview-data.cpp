@@ -9,11 +9,11 @@ HeaderViewData::HeaderViewData(QObject *parent, QWidget *target, int duration) :
 {
 
     _current._animation = new Animation(duration, this);
-    setupAnimation(currentIndexAnimation(), "currentOpacity");
+    setupAnimation(currentIndexAnimation(), &HeaderViewData::setCurrentOpacity);
     currentIndexAnimation().data()->setDirection(Animation::Forward);
 
     _previous._animation = new Animation(duration, this);
-    setupAnimation(previousIndexAnimation(), "previousOpacity");
+    setupAnimation(previousIndexAnimation(), &HeaderViewData::setPreviousOpacity);
     previousIndexAnimation().data()->setDirection(Animation::Backward);
 }
 
@@ -133,9 +133,9 @@ void HeaderViewData::setDirty() const
 
     // trigger update
     if (header->orientation() == Qt::Horizontal) {
-        viewport->update(left, 0, right - left, header->height());
+        FrameClock::instance().update(viewport, QRect(left, 0, right - left, header->height()));
     } else {
-        viewport->update(0, left, header->width(), right - left);
+        FrameClock::instance().update(viewport, QRect(0, left, header->width(), right - left));
     }
 }
 
@@ -22,9 +22,9 @@ ScrollBarData::ScrollBarData(QObject *parent, QWidget *target, int duration) : W
     connect(subLineAnimation().data(), SIGNAL(finished()), SLOT(clearSubLineRect()));
 
     // setup animation
-    setupAnimation(addLineAnimation(), "addLineOpacity");
-    setupAnimation(subLineAnimation(), "subLineOpacity");
-    setupAnimation(grooveAnimation(), "grooveOpacity");
+    setupAnimation(addLineAnimation(), &ScrollBarData::setAddLineOpacity);
+    setupAnimation(subLineAnimation(), &ScrollBarData::setSubLineOpacity);
+    setupAnimation(grooveAnimation(), &ScrollBarData::setGrooveOpacity);
 }
 
 bool ScrollBarData::eventFilter(QObject *object, QEvent *event)
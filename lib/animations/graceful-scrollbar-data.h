@@ -103,7 +103,7 @@ public:
             return;
         }
         _addLineData._opacity = value;
-        setDirty();
+        setDirty(_addLineData._rect);
     }
 
     //* addLine opacity
@@ -122,7 +122,7 @@ public:
             return;
         }
         _subLineData._opacity = value;
-        setDirty();
+        setDirty(_subLineData._rect);
     }
 
     //* subLine opacity
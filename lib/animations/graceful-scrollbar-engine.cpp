@@ -12,17 +12,12 @@ bool ScrollBarEngine::registerWidget(QWidget *widget, AnimationModes mode)
     if (!widget) return false;
 
     // only handle hover and focus
-    if (mode & AnimationHover && !dataMap(AnimationHover).contains(widget)) {
-        dataMap(AnimationHover).insert(widget, new ScrollBarData(this, widget, duration()), enabled());
+    if (mode & AnimationHover && !hasData(widget, AnimationHover)) {
+        setData(widget, AnimationHover, new ScrollBarData(this, widget, duration()));
     }
-    if (mode & AnimationFocus && !dataMap(AnimationFocus).contains(widget)) {
-        dataMap(AnimationFocus).insert(widget, new WidgetStateData(this, widget, duration()), enabled());
-    }
-
-    // connect destruction signal
-    connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(unregisterWidget(QObject *)), Qt::UniqueConnection);
 
-    return true;
+    // focus data is created on first change
+    return WidgetStateEngine::registerWidget(widget, mode & AnimationFocus);
 }
 
 bool ScrollBarEngine::isAnimated(const QObject *object, AnimationMode mode, QStyle::SubControl control)
@@ -11,11 +11,11 @@ TabBarData::TabBarData(QObject *parent, QWidget *target, int duration)
 {
 
     _current._animation = new Animation(duration, this);
-    setupAnimation(currentIndexAnimation(), "currentOpacity");
+    setupAnimation(currentIndexAnimation(), &TabBarData::setCurrentOpacity);
     currentIndexAnimation().data()->setDirection(Animation::Forward);
 
     _previous._animation = new Animation(duration, this);
-    setupAnimation(previousIndexAnimation(), "previousOpacity");
+    setupAnimation(previousIndexAnimation(), &TabBarData::setPreviousOpacity);
     previousIndexAnimation().data()->setDirection(Animation::Backward);
 }
 
@@ -57,7 +57,7 @@ public:
         }
 
         _current._opacity = value;
-        setDirty();
+        setDirty(tabRect(_current._index));
     }
 
     //* current index
@@ -102,7 +102,7 @@ public:
         }
 
         _previous._opacity = value;
-        setDirty();
+        setDirty(tabRect(_previous._index));
     }
 
     //* previous index
@@ -135,6 +135,14 @@ public:
     virtual qreal opacity(const QPoint &position) const;
 
 private:
+    //* rect of given tab, in tabbar coordinates. Empty if none
+    QRect tabRect(int index) const
+    {
+
+        const QTabBar *local(qobject_cast<const QTabBar *>(target().data()));
+        return (local && index >= 0) ? local->tabRect(index) : QRect();
+    }
+
     //* container for needed animation data
     class Data
     {
@@ -29,8 +29,7 @@ TransitionWidget::TransitionWidget(QWidget *parent, int duration):
     // setup animation
     _animation.data()->setStartValue(0);
     _animation.data()->setEndValue(1.0);
-    _animation.data()->setTargetObject(this);
-    _animation.data()->setPropertyName("opacity");
+    _animation.data()->setTarget(this, &TransitionWidget::setOpacity);
 
     // hide when animation is finished
     connect(_animation.data(), SIGNAL(finished()), SLOT(hide()));
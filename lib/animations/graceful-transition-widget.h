@@ -6,6 +6,7 @@
 #include "graceful.h"
 #include "graceful-export.h"
 #include "graceful-animation.h"
+#include "graceful-frame-clock.h"
 
 namespace Graceful
 {
@@ -97,7 +98,7 @@ public:
         }
 
         _opacity = value;
-        update();
+        FrameClock::instance().update(this);
     }
 
     //@}
@@ -1,6 +1,6 @@
 #include "graceful-widget-state-engine.h"
 
-#include "graceful-enable-data.h"
+#include <QEvent>
 
 namespace Graceful
 {
@@ -12,22 +12,46 @@ bool WidgetStateEngine::registerWidget(QWidget *widget, AnimationModes mode)
         return false;
     }
 
-    if (mode & AnimationHover && !_hoverData.contains(widget)) {
-        _hoverData.insert(widget, new WidgetStateData(this, widget, duration()), enabled());
+    // record modes. Already recorded states are kept
+    _lastKey = nullptr;
+    Record &record(_records[widget]);
+    record.modes |= mode;
+
+    // enable changes are not triggered by painting, and must be tracked here
+    if (mode & AnimationEnable) {
+        widget->installEventFilter(this);
     }
-    if (mode & AnimationFocus && !_focusData.contains(widget)) {
-        _focusData.insert(widget, new WidgetStateData(this, widget, duration()), enabled());
+
+    // connect destruction signal
+    connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(unregisterWidget(QObject *)), Qt::UniqueConnection);
+
+    return true;
+}
+
+bool WidgetStateEngine::unregisterWidget(QObject *object)
+{
+
+    if (!object) {
+        return false;
     }
-    if (mode & AnimationEnable && !_enableData.contains(widget)) {
-        _enableData.insert(widget, new EnableData(this, widget, duration()), enabled());
+
+    QHash<const QObject *, Record>::iterator iter(_records.find(object));
+    if (iter == _records.end()) {
+        return false;
     }
-    if (mode & AnimationPressed && !_pressedData.contains(widget)) {
-        _pressedData.insert(widget, new WidgetStateData(this, widget, duration()), enabled());
+
+    if (iter->modes & AnimationEnable) {
+        object->removeEventFilter(this);
     }
 
-    // connect destruction signal
-    connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(unregisterWidget(QObject *)), Qt::UniqueConnection);
+    for (int i = 0; i < ChannelCount; ++i) {
+        if (iter->data[i]) {
+            iter->data[i]->deleteLater();
+        }
+    }
 
+    _lastKey = nullptr;
+    _records.erase(iter);
     return true;
 }
 
@@ -36,40 +60,99 @@ BaseEngine::WidgetList WidgetStateEngine::registeredWidgets(AnimationModes mode)
 
     WidgetList out;
 
-    using Value = DataMap<WidgetStateData>::Value;
-
-    if (mode & AnimationHover) {
-        for (auto value = _hoverData.constBegin(); value != _hoverData.constEnd(); ++value) {
-            if (*value) out.insert(value->data()->target().data());
+    for (auto record = _records.constBegin(); record != _records.constEnd(); ++record) {
+        if (record->modes & mode) {
+            out.insert(static_cast<QWidget *>(const_cast<QObject *>(record.key())));
         }
     }
 
-    if (mode & AnimationFocus) {
-        for (auto value = _focusData.constBegin(); value != _focusData.constEnd(); ++value) {
-            if (*value) out.insert(value->data()->target().data());
+    return out;
+}
+
+void WidgetStateEngine::setEnabled(bool value)
+{
+
+    BaseEngine::setEnabled(value);
+    for (auto record = _records.begin(); record != _records.end(); ++record) {
+        for (int i = 0; i < ChannelCount; ++i) {
+            if (record->data[i]) {
+                record->data[i]->setEnabled(value);
+            }
         }
     }
+}
 
-    if (mode & AnimationEnable) {
-        for (auto value = _enableData.constBegin(); value != _enableData.constEnd(); ++value) {
-            if (*value) out.insert(value->data()->target().data());
+void WidgetStateEngine::setDuration(int value)
+{
+
+    BaseEngine::setDuration(value);
+    for (auto record = _records.begin(); record != _records.end(); ++record) {
+        for (int i = 0; i < ChannelCount; ++i) {
+            if (record->data[i]) {
+                record->data[i]->setDuration(i == channel(AnimationPressed) ? value / 2 : value);
+            }
         }
     }
+}
+
+bool WidgetStateEngine::updateState(const QObject *object, AnimationMode mode, bool value)
+{
+
+    const int index(channel(mode));
+    if (!enabled() || index < 0) {
+        return false;
+    }
+
+    Record *record(this->record(object));
+    if (!record) {
+        return false;
+    }
+
+    if (record->data[index]) {
+        return record->data[index]->updateState(value);
+    }
+
+    if (!(record->modes & mode)) {
+        return false;
+    }
 
-    if (mode & AnimationPressed) {
-        for (auto value = _pressedData.constBegin(); value != _pressedData.constEnd(); ++value) {
-            if (*value) out.insert(value->data()->target().data());
+    // first call only records the initial state, as WidgetStateData does
+    if (!(record->initialized & mode)) {
+        record->initialized |= mode;
+        record->states.setFlag(mode, value);
+        return false;
+    }
+
+    if (record->states.testFlag(mode) == value) {
+        return false;
+    }
+
+    // first change. Create data, seeded with the recorded state
+    QWidget *widget(static_cast<QWidget *>(const_cast<QObject *>(object)));
+    WidgetStateData *created(createData(widget, mode));
+    created->setEnabled(enabled());
+    created->updateState(!value);
+    record->data[index] = created;
+
+    return created->updateState(value);
+}
+
+bool WidgetStateEngine::eventFilter(QObject *object, QEvent *event)
+{
+
+    if (event->type() == QEvent::EnabledChange && enabled()) {
+        if (QWidget *widget = qobject_cast<QWidget *>(object)) {
+            updateState(widget, AnimationEnable, widget->isEnabled());
         }
     }
 
-    return out;
+    return BaseEngine::eventFilter(object, event);
 }
 
-bool WidgetStateEngine::updateState(const QObject *object, AnimationMode mode, bool value)
+WidgetStateData *WidgetStateEngine::createData(QWidget *widget, AnimationMode)
 {
 
-    DataMap<WidgetStateData>::Value data(WidgetStateEngine::data(object, mode));
-    return (data && data.data()->updateState(value));
+    return new WidgetStateData(this, widget, duration());
 }
 
 bool WidgetStateEngine::isAnimated(const QObject *object, AnimationMode mode)
@@ -82,35 +165,74 @@ bool WidgetStateEngine::isAnimated(const QObject *object, AnimationMode mode)
 DataMap<WidgetStateData>::Value WidgetStateEngine::data(const QObject *object, AnimationMode mode)
 {
 
-    switch (mode) {
-    case AnimationHover:
-        return _hoverData.find(object).data();
-    case AnimationFocus:
-        return _focusData.find(object).data();
-    case AnimationEnable:
-        return _enableData.find(object).data();
-    case AnimationPressed:
-        return _pressedData.find(object).data();
-    default:
+    const int index(channel(mode));
+    if (!enabled() || index < 0) {
         return DataMap<WidgetStateData>::Value();
     }
+
+    Record *record(this->record(object));
+    return record ? record->data[index] : nullptr;
 }
 
-DataMap<WidgetStateData> &WidgetStateEngine::dataMap(AnimationMode mode)
+bool WidgetStateEngine::hasData(const QObject *object, AnimationMode mode)
 {
 
+    const int index(channel(mode));
+    Record *record(this->record(object));
+    return index >= 0 && record && record->data[index];
+}
+
+void WidgetStateEngine::setData(QWidget *widget, AnimationMode mode, WidgetStateData *data)
+{
+
+    const int index(channel(mode));
+    if (!widget || index < 0) {
+        return;
+    }
+
+    _lastKey = nullptr;
+    Record &record(_records[widget]);
+    record.modes |= mode;
+    record.data[index] = data;
+    data->setEnabled(enabled());
+
+    // connect destruction signal
+    connect(widget, SIGNAL(destroyed(QObject *)), this, SLOT(unregisterWidget(QObject *)), Qt::UniqueConnection);
+}
+
+int WidgetStateEngine::channel(AnimationMode mode)
+{
 
     switch (mode) {
-    default:
     case AnimationHover:
-        return _hoverData;
+        return 0;
     case AnimationFocus:
-        return _focusData;
+        return 1;
     case AnimationEnable:
-        return _enableData;
+        return 2;
     case AnimationPressed:
-        return _pressedData;
+        return 3;
+    case AnimationSubControlHover:
+        return 4;
+    default:
+        return -1;
+    }
+}
+
+WidgetStateEngine::Record *WidgetStateEngine::record(const QObject *object)
+{
+
+    if (!object) {
+        return nullptr;
     }
+
+    if (object != _lastKey) {
+        QHash<const QObject *, Record>::iterator iter(_records.find(object));
+        _lastKey = object;
+        _lastRecord = (iter == _records.end()) ? nullptr : &iter.value();
+    }
+
+    return _lastRecord;
 }
 
 }
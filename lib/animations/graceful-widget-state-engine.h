@@ -7,6 +7,10 @@
 #include "graceful-base-engine.h"
 #include "graceful-widget-state-data.h"
 
+#include <QHash>
+
+#include <algorithm>
+
 namespace Graceful
 {
 //* used for simple widgets
@@ -17,6 +21,8 @@ public:
     //* constructor
     explicit WidgetStateEngine(QObject *parent)
         : BaseEngine(parent)
+        , _lastKey(nullptr)
+        , _lastRecord(nullptr)
     {
 
     }
@@ -27,7 +33,10 @@ public:
 
     }
 
-    //* register widget
+    /**
+     * register widget.
+     * Only records the widget. Animation data is created on the first state change of each mode
+     */
     virtual bool registerWidget(QWidget *, AnimationModes);
 
     //* returns registered widgets
@@ -38,6 +47,9 @@ public:
     //* true if widget hover state is changed
     virtual bool updateState(const QObject *, AnimationMode, bool);
 
+    //* event filter. Tracks enable state changes
+    virtual bool eventFilter(QObject *, QEvent *);
+
     //* true if widget is animated
     virtual bool isAnimated(const QObject *, AnimationMode);
 
@@ -116,65 +128,68 @@ public:
         }
     }
 
-    //* duration
-    virtual void setEnabled(bool value)
-    {
-
-        BaseEngine::setEnabled(value);
-        _hoverData.setEnabled(value);
-        _focusData.setEnabled(value);
-        _enableData.setEnabled(value);
-        _pressedData.setEnabled(value);
-    }
+    //* enability
+    virtual void setEnabled(bool);
 
     //* duration
-    virtual void setDuration(int value)
-    {
-
-        BaseEngine::setDuration(value);
-        _hoverData.setDuration(value);
-        _focusData.setDuration(value);
-        _enableData.setDuration(value);
-        _pressedData.setDuration(value / 2);
-    }
+    virtual void setDuration(int);
 
 public Q_SLOTS:
     //* remove widget from map
-    virtual bool unregisterWidget(QObject *object)
-    {
-
-        if (!object) {
-            return false;
-        }
-        bool found = false;
-        if (_hoverData.unregisterWidget(object)) {
-            found = true;
-        }
-        if (_focusData.unregisterWidget(object)) {
-            found = true;
-        }
-        if (_enableData.unregisterWidget(object)) {
-            found = true;
-        }
-        if (_pressedData.unregisterWidget(object)) {
-            found = true;
-        }
-        return found;
-    }
+    virtual bool unregisterWidget(QObject *);
 
 protected:
     //* returns data associated to widget
     DataMap<WidgetStateData>::Value data(const QObject *, AnimationMode);
 
-    //* returns data map associated to animation mode
-    DataMap<WidgetStateData> &dataMap(AnimationMode);
+    //* true if animation data exists for given widget and mode
+    bool hasData(const QObject *, AnimationMode);
+
+    //* set animation data for given widget and mode, bypassing lazy creation
+    void setData(QWidget *, AnimationMode, WidgetStateData *);
+
+    //* create animation data for given widget and mode
+    virtual WidgetStateData *createData(QWidget *, AnimationMode);
 
 private:
-    //* maps
-    DataMap<WidgetStateData> _hoverData;
-    DataMap<WidgetStateData> _focusData;
-    DataMap<WidgetStateData> _enableData;
-    DataMap<WidgetStateData> _pressedData;
+    //* number of animation channels
+    enum {
+        ChannelCount = 5
+    };
+
+    //* channel associated to animation mode. -1 if none
+    static int channel(AnimationMode);
+
+    //* all animation channels of a registered widget
+    struct Record {
+        //* constructor
+        Record()
+        {
+            std::fill(data, data + ChannelCount, nullptr);
+        }
+
+        //* registered modes
+        AnimationModes modes;
+
+        //* modes for which an initial state was recorded
+        AnimationModes initialized;
+
+        //* recorded states, until animation data is created
+        AnimationModes states;
+
+        //* animation data, per channel. Owned by the engine and created on first change
+        WidgetStateData *data[ChannelCount];
+    };
+
+    //* find record, through a single entry cache since the paint path queries several modes in a row
+    Record *record(const QObject *);
+
+    //* registered widgets
+    QHash<const QObject *, Record> _records;
+
+    //* last record lookup
+    const QObject *_lastKey;
+    Record *_lastRecord;
 };
 
 }
@@ -2,6 +2,11 @@
 
 #include "animations/graceful-animation-data.h"
 
+#include <QHash>
+#include <QPair>
+#include <QVector>
+#include <QPointer>
+#include <QAtomicInt>
 #include <QtMath>
 #include <QGuiApplication>
 
@@ -102,7 +107,10 @@ QColor Colors::transparentize(const QColor &color, qreal amount)
     return QColor::fromHslF(h, s, l, alpha);
 }
 
-static bool isDarkMode()
+//* cached dark mode, negative until computed. Reset when the application emits paletteChanged
+static QAtomicInt darkMode(-1);
+
+static bool computeDarkMode()
 {
 
     const QColor textColor = QGuiApplication::palette().color(QPalette::Text);
@@ -115,21 +123,67 @@ static bool isDarkMode()
     return false;
 }
 
+bool Colors::isDarkMode()
+{
+
+    int value(darkMode.loadAcquire());
+    if (value >= 0) {
+        return value;
+    }
+
+    value = computeDarkMode() ? 1 : 0;
+
+    // without an application, there is no palette change to invalidate the value
+    if (qGuiApp) {
+        static QPointer<QGuiApplication> application;
+        if (application != qGuiApp) {
+            application = qGuiApp;
+            QObject::connect(qGuiApp, &QGuiApplication::paletteChanged, [] {
+                darkMode.storeRelease(-1);
+            });
+        }
+
+        darkMode.storeRelease(value);
+    }
+
+    return value;
+}
+
+ColorVariant Colors::resolveColorVariant(ColorVariant variant)
+{
+
+    if (variant == ColorVariant::Unknown) {
+        return isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
+    }
+
+    return variant;
+}
+
+//* source colors, defined in GTK Graceful style in _colors.scss
+static Q_DECL_CONSTEXPR const QRgb gtkWhite = qRgb(0xff, 0xff, 0xff);
+static Q_DECL_CONSTEXPR const QRgb gtkBlack = qRgb(0x00, 0x00, 0x00);
+static Q_DECL_CONSTEXPR const QRgb gtkBackground = qRgb(0xf6, 0xf5, 0xf4);
+static Q_DECL_CONSTEXPR const QRgb gtkForeground = qRgb(0x2e, 0x34, 0x36);
+static Q_DECL_CONSTEXPR const QRgb gtkSelectedBackground = qRgb(0x35, 0x84, 0xe4);
+static Q_DECL_CONSTEXPR const QRgb gtkDarkBase = qRgb(0x24, 0x1f, 0x31);
+static Q_DECL_CONSTEXPR const QRgb gtkDarkBackground = qRgb(0x3d, 0x38, 0x46);
+static Q_DECL_CONSTEXPR const QRgb gtkDarkForeground = qRgb(0xee, 0xee, 0xec);
+
 static QPalette paletteGraceful()
 {
 
     QPalette palette;
 
     // Colors defined in GTK Graceful style in _colors.scss
-    QColor base_color = QColor("white");
-    QColor text_color = QColor("black");
-    QColor bg_color = QColor("#f6f5f4");
-    QColor fg_color = QColor("#2e3436");
-    QColor selected_bg_color = QColor("#3584e4");
-    QColor selected_fg_color = QColor("white");
-    QColor osd_text_color = QColor("white");
-    QColor osd_bg_color = QColor("black");
-    QColor shadow = Colors::transparentize(QColor("black"), 0.9);
+    QColor base_color = QColor(gtkWhite);
+    QColor text_color = QColor(gtkBlack);
+    QColor bg_color = QColor(gtkBackground);
+    QColor fg_color = QColor(gtkForeground);
+    QColor selected_bg_color = QColor(gtkSelectedBackground);
+    QColor selected_fg_color = QColor(gtkWhite);
+    QColor osd_text_color = QColor(gtkWhite);
+    QColor osd_bg_color = QColor(gtkBlack);
+    QColor shadow = Colors::transparentize(QColor(gtkBlack), 0.9);
 
     QColor backdrop_fg_color = Colors::mix(fg_color, bg_color);
     QColor backdrop_base_color = Colors::darken(base_color, 0.01);
@@ -221,15 +275,15 @@ static QPalette paletteGracefulDark()
     QPalette palette;
 
     // Colors defined in GTK Graceful style in _colors.scss
-    QColor base_color = Colors::lighten(Colors::desaturate(QColor("#241f31"), 1.0), 0.02);
-    QColor text_color = QColor("white");
-    QColor bg_color = Colors::darken(Colors::desaturate(QColor("#3d3846"), 1.0), 0.04);
-    QColor fg_color = QColor("#eeeeec");
-    QColor selected_bg_color = Colors::darken(QColor("#3584e4"), 0.2);
-    QColor selected_fg_color = QColor("white");
-    QColor osd_text_color = QColor("white");
-    QColor osd_bg_color = QColor("black");
-    QColor shadow = Colors::transparentize(QColor("black"), 0.9);
+    QColor base_color = Colors::lighten(Colors::desaturate(QColor(gtkDarkBase), 1.0), 0.02);
+    QColor text_color = QColor(gtkWhite);
+    QColor bg_color = Colors::darken(Colors::desaturate(QColor(gtkDarkBackground), 1.0), 0.04);
+    QColor fg_color = QColor(gtkDarkForeground);
+    QColor selected_bg_color = Colors::darken(QColor(gtkSelectedBackground), 0.2);
+    QColor selected_fg_color = QColor(gtkWhite);
+    QColor osd_text_color = QColor(gtkWhite);
+    QColor osd_bg_color = QColor(gtkBlack);
+    QColor shadow = Colors::transparentize(QColor(gtkBlack), 0.9);
 
     QColor backdrop_fg_color = Colors::mix(fg_color, bg_color);
     QColor backdrop_base_color = Colors::lighten(base_color, 0.01);
@@ -339,30 +393,131 @@ QPalette Colors::disabledPalette(const QPalette &source, qreal ratio)
 
 QPalette Colors::palette(ColorVariant variant)
 {
+    // palettes only depend on constant source colors. They are built once and shared implicitly
+    static const QPalette graceful(paletteGraceful());
+    static const QPalette gracefulDark(paletteGracefulDark());
+
     if (variant == ColorVariant::Unknown) {
-        return isDarkMode() ? paletteGracefulDark() : paletteGraceful();
+        return isDarkMode() ? gracefulDark : graceful;
     } else if (variant == ColorVariant::Graceful) {
-        return paletteGraceful();
+        return graceful;
     } else if (variant == ColorVariant::GracefulDark) {
-        return paletteGracefulDark();
+        return gracefulDark;
     } else {
         // TODO
         return paletteGracefulHighContrast();
     }
 }
 
-QColor Colors::hoverColor(const StyleOptions &options)
+//* maximum number of color ramps kept around
+static const int colorRampCacheSize = 128;
+
+QColor Colors::rampColor(const QColor &from, const QColor &to, qreal opacity)
 {
-    return options.palette().highlight().color();
+
+    // animation opacities are digitized to AnimationSteps levels. Anything else is mixed directly
+    const int step(qRound(opacity * Config::AnimationSteps));
+    if (step < 0 || step > Config::AnimationSteps || qreal(step) / Config::AnimationSteps != opacity) {
+        return mix(from, to, opacity);
+    }
+
+    typedef QPair<quint64, quint64> RampKey;
+    static QHash<RampKey, QVector<QColor> > ramps;
+
+    const RampKey key(from.rgba64(), to.rgba64());
+    auto iter(ramps.constFind(key));
+    if (iter == ramps.constEnd()) {
+        if (ramps.size() >= colorRampCacheSize) {
+            ramps.clear();
+        }
+
+        // entries go through mix, which keeps the 16 bit channels of both colors
+        QVector<QColor> ramp(Config::AnimationSteps + 1);
+        for (int i = 0; i <= Config::AnimationSteps; ++i) {
+            ramp[i] = mix(from, to, qreal(i) / Config::AnimationSteps);
+        }
+
+        iter = ramps.insert(key, ramp);
+    }
+
+    return iter.value().at(step);
 }
 
-QColor Colors::focusColor(const StyleOptions &options)
+static ColorScheme createColorScheme(const PaintOptions &options, bool darkMode)
 {
 
-    return options.palette().highlight().color();
+    ColorScheme scheme;
+
+    const QColor background(options.color(QPalette::Window));
+    const QColor highlight(options.color(QPalette::Highlight));
+    const QColor activeWindow(options.color(QPalette::Active, QPalette::Window));
+    const QColor activeBase(options.color(QPalette::Active, QPalette::Base));
+
+    // Defined in drawing.css - button, with dark mode values first
+    scheme.button = options.color(QPalette::Button);
+    scheme.buttonHover = darkMode ? Colors::darken(background, 0.01) : background;
+    scheme.buttonPressed = Colors::darken(background, darkMode ? 0.09 : 0.14);
+    scheme.buttonPressedFrom = darkMode ? Colors::darken(background, 0.01) : scheme.button;
+    scheme.buttonDisabledPressed = Colors::darken(Colors::mix(activeWindow, activeBase, 0.15), darkMode ? 0.06 : 0.08);
+    scheme.buttonOutline = Colors::darken(background, darkMode ? 0.1 : 0.18);
+
+    // Normal-alt and hovered-alt buttons
+    scheme.indicator = darkMode ? Colors::darken(background, 0.03) : Colors::lighten(background, 0.05);
+    scheme.indicatorHover = darkMode ? background : Colors::lighten(background, 0.09);
+    scheme.indicatorPressedFrom = darkMode ? background : Colors::lighten(background, 0.0);
+    scheme.indicatorDisabled = Colors::mix(activeWindow, activeBase, 0.6);
+    scheme.indicatorChecked = darkMode ? Colors::lighten(highlight) : highlight;
+    scheme.indicatorOutline = Colors::darken(background, darkMode ? 0.18 : 0.24);
+    scheme.checkBoxIndicatorInactive = Colors::transparentize(options.color(QPalette::ToolTipText), 0.2);
+
+    const QColor foreground(options.color(QPalette::Text));
+    scheme.scrollBarHandle = Colors::mix(foreground, background, 0.4);
+    scheme.scrollBarHandleHover = Colors::mix(foreground, background, 0.2);
+    scheme.scrollBarHandleActive = darkMode ? Colors::lighten(highlight, 0.1) : Colors::darken(highlight, 0.1);
+
+    return scheme;
 }
 
-QColor Colors::negativeText(const StyleOptions &options)
+ColorScheme Colors::colorScheme(const PaintOptions &options)
+{
+
+    const ColorVariant variant = options.resolvedColorVariant();
+    const QPalette::ColorGroup group = options.currentColorGroup();
+    if (group < 0 || group >= QPalette::NColorGroups) {
+        return createColorScheme(options, variant == ColorVariant::GracefulDark);
+    }
+
+    // one scheme per color group and variant, built once.
+    // All roles read by createColorScheme are theme roles, which PaintOptions::color takes from
+    // the shared theme palette rather than from the source palette
+    struct Slot {
+        bool valid;
+        ColorScheme scheme;
+    };
+
+    static Slot schemes[QPalette::NColorGroups][ColorVariant::GracefulHighcontrast + 1] = {};
+
+    Slot &slot(schemes[group][variant]);
+    if (!slot.valid) {
+        slot.scheme = createColorScheme(options, variant == ColorVariant::GracefulDark);
+        slot.valid = true;
+    }
+
+    return slot.scheme;
+}
+
+QColor Colors::hoverColor(const PaintOptions &options)
+{
+    return options.color(QPalette::Highlight);
+}
+
+QColor Colors::focusColor(const PaintOptions &options)
+{
+
+    return options.color(QPalette::Highlight);
+}
+
+QColor Colors::negativeText(const PaintOptions &options)
 {
 
     Q_UNUSED(options)
@@ -370,87 +525,67 @@ QColor Colors::negativeText(const StyleOptions &options)
     return Qt::red;
 }
 
-QColor Colors::shadowColor(const StyleOptions &options)
+QColor Colors::shadowColor(const PaintOptions &options)
 {
 
-    return alphaColor(options.palette().color(QPalette::Shadow), 0.15);
+    return alphaColor(options.color(QPalette::Shadow), 0.15);
 }
 
-QColor Colors::titleBarColor(const StyleOptions &options)
+QColor Colors::titleBarColor(const PaintOptions &options)
 {
 
-    return options.palette().color(options.active() ? QPalette::Active : QPalette::Inactive, QPalette::Window);
+    return options.color(options.active() ? QPalette::Active : QPalette::Inactive, QPalette::Window);
 }
 
-QColor Colors::titleBarTextColor(const StyleOptions &options)
+QColor Colors::titleBarTextColor(const PaintOptions &options)
 {
 
-    return options.palette().color(options.active() ? QPalette::Active : QPalette::Inactive, QPalette::WindowText);
+    return options.color(options.active() ? QPalette::Active : QPalette::Inactive, QPalette::WindowText);
 }
 
-QColor Colors::arrowOutlineColor(const StyleOptions &options)
+QColor Colors::arrowOutlineColor(const PaintOptions &options)
 {
 
     switch (options.colorRole()) {
     case QPalette::Text:
-        return mix(options.palette().color(options.colorGroup(), QPalette::Text), options.palette().color(options.colorGroup(), QPalette::Base), arrowShade);
+        return mix(options.color(options.colorGroup(), QPalette::Text), options.color(options.colorGroup(), QPalette::Base), arrowShade);
     case QPalette::WindowText:
-        return mix(options.palette().color(options.colorGroup(), QPalette::WindowText), options.palette().color(options.colorGroup(), QPalette::Window), arrowShade);
+        return mix(options.color(options.colorGroup(), QPalette::WindowText), options.color(options.colorGroup(), QPalette::Window), arrowShade);
     case QPalette::ButtonText:
-        return mix(options.palette().color(options.colorGroup(), QPalette::ButtonText), options.palette().color(options.colorGroup(), QPalette::Button), arrowShade);
+        return mix(options.color(options.colorGroup(), QPalette::ButtonText), options.color(options.colorGroup(), QPalette::Button), arrowShade);
     default:
-        return options.palette().text().color();
+        return options.color(QPalette::Text);
     }
 }
 
-QColor Colors::buttonOutlineColor(const StyleOptions &options)
+QColor Colors::buttonOutlineColor(const PaintOptions &options)
 {
 
-    ColorVariant variant = options.colorVariant();
-
-    if (variant == ColorVariant::Unknown) {
-        variant = isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
-    }
-
-    if (variant == ColorVariant::GracefulDark) {
-        return darken(options.palette().color(QPalette::Window), 0.1);
-    } else {
-        return darken(options.palette().color(QPalette::Window), 0.18);
-    }
+    return colorScheme(options).buttonOutline;
 }
 
-QColor Colors::indicatorOutlineColor(const StyleOptions &options)
+QColor Colors::indicatorOutlineColor(const PaintOptions &options)
 {
 
-    bool isDisabled = options.palette().currentColorGroup() == QPalette::Disabled;
+    bool isDisabled = options.currentColorGroup() == QPalette::Disabled;
     if (options.inMenu() || options.checkboxState() == CheckBoxState::CheckOff) {
-        ColorVariant variant = options.colorVariant();
-
-        if (variant == ColorVariant::Unknown) {
-            variant = isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
-        }
-
         if (isDisabled) {
             return buttonOutlineColor(options);
         }
 
-        if (variant == ColorVariant::GracefulDark) {
-            return darken(options.palette().color(QPalette::Window), 0.18);
-        } else {
-            return darken(options.palette().color(QPalette::Window), 0.24);
-        }
+        return colorScheme(options).indicatorOutline;
     } else {
-        return options.palette().color(QPalette::Highlight);
+        return options.color(QPalette::Highlight);
     }
 }
 
-QColor Colors::frameOutlineColor(const StyleOptions &options)
+QColor Colors::frameOutlineColor(const PaintOptions &options)
 {
 
     return inputOutlineColor(options);
 }
 
-QColor Colors::inputOutlineColor(const StyleOptions &options)
+QColor Colors::inputOutlineColor(const PaintOptions &options)
 {
 
     QColor outline(buttonOutlineColor(options));
@@ -465,14 +600,14 @@ QColor Colors::inputOutlineColor(const StyleOptions &options)
     return outline;
 }
 
-QColor Colors::sidePanelOutlineColor(const StyleOptions &options)
+QColor Colors::sidePanelOutlineColor(const PaintOptions &options)
 {
 
-    QColor outline(options.palette().color(QPalette::Inactive, QPalette::Highlight));
-    QColor focus(options.palette().color(QPalette::Active, QPalette::Highlight));
+    QColor outline(options.color(QPalette::Inactive, QPalette::Highlight));
+    QColor focus(options.color(QPalette::Active, QPalette::Highlight));
 
     if (options.animationMode() == AnimationFocus) {
-        outline = mix(outline, focus, options.opacity());
+        outline = rampColor(outline, focus, options.opacity());
     } else if (options.hasFocus()) {
         outline = focus;
     }
@@ -480,25 +615,25 @@ QColor Colors::sidePanelOutlineColor(const StyleOptions &options)
     return outline;
 }
 
-QColor Colors::sliderOutlineColor(const StyleOptions &options)
+QColor Colors::sliderOutlineColor(const PaintOptions &options)
 {
 
-    QColor outline(mix(options.palette().color(QPalette::Window), options.palette().color(QPalette::Shadow), 0.5));
+    QColor outline(mix(options.color(QPalette::Window), options.color(QPalette::Shadow), 0.5));
 
     // hover takes precedence over focus
     if (options.animationMode() == AnimationHover) {
         QColor hover(hoverColor(options));
         QColor focus(focusColor(options));
         if (options.hasFocus()) {
-            outline = mix(focus, hover, options.opacity());
+            outline = rampColor(focus, hover, options.opacity());
         } else {
-            outline = mix(outline, hover, options.opacity());
+            outline = rampColor(outline, hover, options.opacity());
         }
     } else if (options.mouseOver()) {
         outline = hoverColor(options);
     } else if (options.animationMode() == AnimationFocus) {
         QColor focus(focusColor(options));
-        outline = mix(outline, focus, options.opacity());
+        outline = rampColor(outline, focus, options.opacity());
     } else if (options.hasFocus()) {
         outline = focusColor(options);
     }
@@ -506,85 +641,50 @@ QColor Colors::sliderOutlineColor(const StyleOptions &options)
     return outline;
 }
 
-QColor Colors::buttonBackgroundColor(const StyleOptions &options)
+QColor Colors::buttonBackgroundColor(const PaintOptions &options)
 {
 
-    bool isDisabled = options.palette().currentColorGroup() == QPalette::Disabled;
-    QColor buttonBackground(options.palette().color(QPalette::Button));
-    QColor background(options.palette().color(QPalette::Window));
-
-    ColorVariant variant = options.colorVariant();
-
-    if (variant == ColorVariant::Unknown) {
-        variant = isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
-    }
-
-    const bool darkMode = variant == ColorVariant::GracefulDark;
-    const QPalette &palette = options.palette();
+    bool isDisabled = options.currentColorGroup() == QPalette::Disabled;
+    const ColorScheme scheme(colorScheme(options));
 
     if (isDisabled && (options.animationMode() == AnimationPressed || options.sunken())) {
         // Defined in drawing.css - insensitive-active button
         // if($variant == 'light', Colors::darken(Colors::mix($c, $base_color, 85%), 8%), Colors::darken(Colors::mix($c, $base_color, 85%), 6%));
         // FIXME: doesn't seem to be correct color
-        return darkMode ? Colors::darken(Colors::mix(palette.color(QPalette::Active, QPalette::Window), palette.color(QPalette::Active, QPalette::Base), 0.15), 0.06) :
-               Colors::darken(Colors::mix(palette.color(QPalette::Active, QPalette::Window), palette.color(QPalette::Active, QPalette::Base), 0.15), 0.08);
+        return scheme.buttonDisabledPressed;
     }
 
     if (options.animationMode() == AnimationPressed) {
-        if (darkMode) {
-            // Active button for dark mode is Colors::darken(bg_color, 0.09)
-            return Colors::mix(Colors::darken(background, 0.01), Colors::darken(background, 0.09), options.opacity());
-        } else {
-            // Active button for normal mode is Colors::darken(bg_color, 0.14)
-            return Colors::mix(buttonBackground, Colors::darken(background, 0.14), options.opacity());
-        }
+        return Colors::rampColor(scheme.buttonPressedFrom, scheme.buttonPressed, options.opacity());
     } else if (options.sunken()) {
-        if (darkMode) {
-            // Active button for dark mode is Colors::darken(bg_color, 0.09)
-            return Colors::darken(background, 0.09);
-        } else {
-            // Active button for normal mode is Colors::darken(bg_color, 0.14)
-            return Colors::darken(background, 0.14);
-        }
+        return scheme.buttonPressed;
     } else if (options.animationMode() == AnimationHover) {
-        if (darkMode) {
-            // Hovered button for dark mode is Colors::darken(bg_color, 0.01)
-            return Colors::mix(buttonBackground, Colors::darken(background, 0.01), options.opacity());
-        } else {
-            // Hovered button for normal mode is bg_color
-            return Colors::mix(buttonBackground, background, options.opacity());
-        }
+        return Colors::rampColor(scheme.button, scheme.buttonHover, options.opacity());
     } else if (options.mouseOver()) {
-        if (darkMode) {
-            // Hovered button for dark mode is Colors::darken(bg_color, 0.01)
-            return Colors::darken(background, 0.01);
-        } else {
-            // Hovered button for normal mode is bg_color
-            return background;
-        }
+        return scheme.buttonHover;
     }
 
-    return buttonBackground;
+    return scheme.button;
 }
 
-QColor Colors::checkBoxIndicatorColor(const StyleOptions &options)
+QColor Colors::checkBoxIndicatorColor(const PaintOptions &options)
 {
 
     if (options.inMenu()) {
-        return options.palette().color(QPalette::Text);
+        return options.color(QPalette::Text);
     } else {
         if (options.active()) {
-            return options.palette().color(QPalette::HighlightedText);
+            return options.color(QPalette::HighlightedText);
         } else {
-            return Colors::transparentize(options.palette().color(QPalette::ToolTipText), 0.2);
+            return colorScheme(options).checkBoxIndicatorInactive;
         }
     }
 }
 
-QColor Colors::headerTextColor(const StyleOptions &options)
+QColor Colors::headerTextColor(const PaintOptions &options)
 {
 
-    QColor col(options.palette().color(QPalette::WindowText));
+    QColor col(options.color(QPalette::WindowText));
 
     if (options.state() & QStyle::State_Enabled) {
         if (options.state() & QStyle::State_Sunken) {
@@ -596,123 +696,72 @@ QColor Colors::headerTextColor(const StyleOptions &options)
     return Colors::alphaColor(col, 0.5);
 }
 
-QColor Colors::indicatorBackgroundColor(const StyleOptions &options)
+QColor Colors::indicatorBackgroundColor(const PaintOptions &options)
 {
 
-    ColorVariant variant = options.colorVariant();
-
-    if (variant == ColorVariant::Unknown) {
-        variant = isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
-    }
-
-    const QPalette &palette = options.palette();
-    const bool darkMode = variant == ColorVariant::GracefulDark;
-
-    bool isDisabled = palette.currentColorGroup() == QPalette::Disabled;
-    QColor background(palette.color(QPalette::Window));
-    // Normal-alt button for dark mode is Colors::darken(bg_color, 0.03)
-    // Normal-alt button for normal mode is Colors::lighten(bg_color, 0.05)
-    QColor indicatorColor(darkMode ? Colors::darken(background, 0.03) : Colors::lighten(background, 0.05));
+    bool isDisabled = options.currentColorGroup() == QPalette::Disabled;
+    const ColorScheme scheme(colorScheme(options));
 
     if (options.inMenu() || options.checkboxState() == CheckOff) {
         if (isDisabled) {
             // Defined in drawing.css - insensitive button
             // $insensitive_bg_color: Colors::mix($bg_color, $base_color, 60%);
-            return Colors::mix(palette.color(QPalette::Active, QPalette::Window), palette.color(QPalette::Active, QPalette::Base), 0.6);
+            return scheme.indicatorDisabled;
         }
 
         if (options.animationMode() == AnimationPressed) {
-            if (darkMode) {
-                // Active button for dark mode is Colors::darken(bg_color, 0.09)
-                return Colors::mix(background, Colors::darken(background, 0.09), options.opacity());
-            } else {
-                // Active button for normal mode is Colors::darken(bg_color, 0.14)
-                return Colors::mix(Colors::lighten(background, 0.0), Colors::darken(background, 0.14), options.opacity());
-            }
+            return Colors::rampColor(scheme.indicatorPressedFrom, scheme.buttonPressed, options.opacity());
         } else if (options.sunken()) {
-            if (darkMode) {
-                // Active button for dark mode is Colors::darken(bg_color, 0.09)
-                return Colors::darken(background, 0.09);
-            } else {
-                // Active button for normal mode is Colors::darken(bg_color, 0.14)
-                return Colors::darken(background, 0.14);
-            }
+            return scheme.buttonPressed;
         } else if (options.animationMode() == AnimationHover) {
-            if (darkMode) {
-                // Hovered-alt button for dark mode is bg_color
-                return Colors::mix(indicatorColor, background, options.opacity());
-            } else {
-                // Hovered-alt button for normal mode is Colors::lighten(bg_color, 0.09)
-                return Colors::mix(indicatorColor, Colors::lighten(background, 0.09), options.opacity());
-            }
+            return Colors::rampColor(scheme.indicator, scheme.indicatorHover, options.opacity());
         } else if (options.mouseOver()) {
-            if (darkMode) {
-                // Hovered-alt button for dark mode is bg_color
-                return background;
-            } else {
-                // Hovered-alt button for normal mode is Colors::lighten(bg_color, 0.09)
-                return Colors::lighten(background, 0.09);
-            }
+            return scheme.indicatorHover;
         }
     } else {
-        if (darkMode) {
-            return Colors::lighten(palette.color(QPalette::Highlight));
-        } else {
-            return palette.color(QPalette::Highlight);
-        }
+        return scheme.indicatorChecked;
     }
 
-    return indicatorColor;
+    return scheme.indicator;
 }
 
-QColor Colors::frameBackgroundColor(const StyleOptions &options)
+QColor Colors::frameBackgroundColor(const PaintOptions &options)
 {
 
-    return Colors::mix(options.palette().color(options.colorGroup(), QPalette::Window), options.palette().color(options.colorGroup(), QPalette::Base), 0.3);
+    return Colors::mix(options.color(options.colorGroup(), QPalette::Window), options.color(options.colorGroup(), QPalette::Base), 0.3);
 }
 
-QColor Colors::scrollBarHandleColor(const StyleOptions &options)
+QColor Colors::scrollBarHandleColor(const PaintOptions &options)
 {
 
-    ColorVariant variant = options.colorVariant();
-
-    if (variant == ColorVariant::Unknown) {
-        variant = isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
-    }
-
-    QColor fgColor = options.palette().color(QPalette::Text);
-    QColor bgColor = options.palette().color(QPalette::Window);
-    QColor selectedBgColor = options.palette().color(QPalette::Highlight);
-
-    QColor color(Colors::mix(fgColor, bgColor, 0.4));
-    QColor hoverColor(Colors::mix(fgColor, bgColor, 0.2));
-    QColor activeColor(variant == ColorVariant::GracefulDark ? Colors::lighten(selectedBgColor, 0.1) : Colors::darken(selectedBgColor, 0.1));
+    const ColorScheme scheme(colorScheme(options));
+    QColor color(scheme.scrollBarHandle);
 
     // hover takes precedence over focus
     if (options.animationMode() == AnimationPressed) {
         if (options.mouseOver()) {
-            color = Colors::mix(hoverColor, activeColor, options.opacity());
+            color = Colors::rampColor(scheme.scrollBarHandleHover, scheme.scrollBarHandleActive, options.opacity());
         } else {
-            color = Colors::mix(color, activeColor, options.opacity());
+            color = Colors::rampColor(color, scheme.scrollBarHandleActive, options.opacity());
         }
     } else if (options.sunken()) {
-        color = activeColor;
+        color = scheme.scrollBarHandleActive;
     } else if (options.animationMode() == AnimationHover) {
-        color = Colors::mix(color, hoverColor, options.opacity());
+        color = Colors::rampColor(color, scheme.scrollBarHandleHover, options.opacity());
     } else if (options.mouseOver()) {
-        color = hoverColor;
+        color = scheme.scrollBarHandleHover;
     }
 
     return color;
 }
 
-QColor Colors::separatorColor(const StyleOptions &options)
+QColor Colors::separatorColor(const PaintOptions &options)
 {
 
     return buttonOutlineColor(options);
 }
 
-QColor Colors::toolButtonColor(const StyleOptions &options)
+QColor Colors::toolButtonColor(const PaintOptions &options)
 {
 
     if (options.sunken() || (options.animationMode() != AnimationNone && options.animationMode() != AnimationHover)) {
@@ -722,10 +771,10 @@ QColor Colors::toolButtonColor(const StyleOptions &options)
     return Qt::transparent;
 }
 
-QColor Colors::tabBarColor(const StyleOptions &options)
+QColor Colors::tabBarColor(const PaintOptions &options)
 {
 
-    QColor background(Colors::mix(options.palette().window().color(), options.palette().shadow().color(), 0.15));
+    QColor background(Colors::mix(options.color(QPalette::Window), options.color(QPalette::Shadow), 0.15));
     if (!(options.state() & QStyle::State_Enabled)) {
         background = background.lighter(115);
     }
@@ -736,4 +785,114 @@ QColor Colors::tabBarColor(const StyleOptions &options)
     return background;
 }
 
+QColor Colors::hoverColor(const StyleOptions &options)
+{
+    return hoverColor(options.paintOptions());
+}
+
+QColor Colors::focusColor(const StyleOptions &options)
+{
+    return focusColor(options.paintOptions());
+}
+
+QColor Colors::negativeText(const StyleOptions &options)
+{
+    return negativeText(options.paintOptions());
+}
+
+QColor Colors::shadowColor(const StyleOptions &options)
+{
+    return shadowColor(options.paintOptions());
+}
+
+QColor Colors::titleBarColor(const StyleOptions &options)
+{
+    return titleBarColor(options.paintOptions());
+}
+
+QColor Colors::titleBarTextColor(const StyleOptions &options)
+{
+    return titleBarTextColor(options.paintOptions());
+}
+
+QColor Colors::arrowOutlineColor(const StyleOptions &options)
+{
+    return arrowOutlineColor(options.paintOptions());
+}
+
+QColor Colors::buttonOutlineColor(const StyleOptions &options)
+{
+    return buttonOutlineColor(options.paintOptions());
+}
+
+QColor Colors::indicatorOutlineColor(const StyleOptions &options)
+{
+    return indicatorOutlineColor(options.paintOptions());
+}
+
+QColor Colors::frameOutlineColor(const StyleOptions &options)
+{
+    return frameOutlineColor(options.paintOptions());
+}
+
+QColor Colors::inputOutlineColor(const StyleOptions &options)
+{
+    return inputOutlineColor(options.paintOptions());
+}
+
+QColor Colors::sidePanelOutlineColor(const StyleOptions &options)
+{
+    return sidePanelOutlineColor(options.paintOptions());
+}
+
+QColor Colors::sliderOutlineColor(const StyleOptions &options)
+{
+    return sliderOutlineColor(options.paintOptions());
+}
+
+QColor Colors::buttonBackgroundColor(const StyleOptions &options)
+{
+    return buttonBackgroundColor(options.paintOptions());
+}
+
+QColor Colors::checkBoxIndicatorColor(const StyleOptions &options)
+{
+    return checkBoxIndicatorColor(options.paintOptions());
+}
+
+QColor Colors::headerTextColor(const StyleOptions &options)
+{
+    return headerTextColor(options.paintOptions());
+}
+
+QColor Colors::indicatorBackgroundColor(const StyleOptions &options)
+{
+    return indicatorBackgroundColor(options.paintOptions());
+}
+
+QColor Colors::frameBackgroundColor(const StyleOptions &options)
+{
+    return frameBackgroundColor(options.paintOptions());
+}
+
+QColor Colors::scrollBarHandleColor(const StyleOptions &options)
+{
+    return scrollBarHandleColor(options.paintOptions());
+}
+
+QColor Colors::separatorColor(const StyleOptions &options)
+{
+    return separatorColor(options.paintOptions());
+}
+
+QColor Colors::toolButtonColor(const StyleOptions &options)
+{
+    return toolButtonColor(options.paintOptions());
+}
+
+QColor Colors::tabBarColor(const StyleOptions &options)
+{
+    return tabBarColor(options.paintOptions());
+}
+
 }
@@ -6,6 +6,35 @@
 #include <QColor>
 
 namespace Graceful {
+/**
+ * colors derived from a palette, for a given color group and variant.
+ * Computed once and shared, so that the paint path does not redo HSL adjustments
+ */
+struct ColorScheme
+{
+    //* button
+    QColor button;
+    QColor buttonHover;
+    QColor buttonPressed;
+    QColor buttonPressedFrom;
+    QColor buttonDisabledPressed;
+    QColor buttonOutline;
+
+    //* checkbox and radio button indicators
+    QColor indicator;
+    QColor indicatorHover;
+    QColor indicatorPressedFrom;
+    QColor indicatorDisabled;
+    QColor indicatorChecked;
+    QColor indicatorOutline;
+    QColor checkBoxIndicatorInactive;
+
+    //* scrollbar handle
+    QColor scrollBarHandle;
+    QColor scrollBarHandleHover;
+    QColor scrollBarHandleActive;
+};
+
 class GRACEFUL_EXPORT Colors
 {
 public:
@@ -17,38 +46,53 @@ public:
     static QColor transparentize(const QColor &color, qreal amount = 0.1);
     static QColor mix(const QColor &c1, const QColor &c2, qreal bias = 0.5);
 
+    // same as mix, for animation opacities. Ramps of AnimationSteps colors are precomputed and shared
+    static QColor rampColor(const QColor &from, const QColor &to, qreal opacity);
+
     static QPalette disabledPalette(const QPalette &source, qreal ratio);
 
     static QPalette palette(ColorVariant variant = ColorVariant::Unknown);
 
+    // true if the application palette is dark. Cached until the application palette changes
+    static bool isDarkMode();
+
+    // variant matching the application palette if variant is Unknown, variant otherwise
+    static ColorVariant resolveColorVariant(ColorVariant variant);
+
+    /* Relevant options:
+       * palette
+       * color variant
+     */
+    static ColorScheme colorScheme(const PaintOptions &options);
+
     // Generic colors
 
     /* Relevant options:
        * palette
      */
-    static QColor hoverColor(const StyleOptions &options);
+    static QColor hoverColor(const PaintOptions &options);
     /* Relevant options:
        * palette
      */
-    static QColor focusColor(const StyleOptions &options);
+    static QColor focusColor(const PaintOptions &options);
     /* Relevant options:
        * palette
      */
-    static QColor negativeText(const StyleOptions &options);
+    static QColor negativeText(const PaintOptions &options);
     /* Relevant options:
        * palette
      */
-    static QColor shadowColor(const StyleOptions &options);
+    static QColor shadowColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * active
      */
-    static QColor titleBarColor(const StyleOptions &options);
+    static QColor titleBarColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * active
      */
-    static QColor titleBarTextColor(const StyleOptions &options);
+    static QColor titleBarTextColor(const PaintOptions &options);
 
     // Outline colors
 
@@ -57,7 +101,7 @@ public:
        * color role
        * color group
      */
-    static QColor arrowOutlineColor(const StyleOptions &options);
+    static QColor arrowOutlineColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -66,7 +110,7 @@ public:
        * animation mode
        * color variant
      */
-    static QColor buttonOutlineColor(const StyleOptions &options);
+    static QColor buttonOutlineColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -77,7 +121,7 @@ public:
        * color variant
        * in menu
      */
-    static QColor indicatorOutlineColor(const StyleOptions &options);
+    static QColor indicatorOutlineColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -86,7 +130,7 @@ public:
        * animation mode
        * color variant
      */
-    static QColor frameOutlineColor(const StyleOptions &options);
+    static QColor frameOutlineColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -95,14 +139,14 @@ public:
        * animation mode
        * color variant
      */
-    static QColor inputOutlineColor(const StyleOptions &options);
+    static QColor inputOutlineColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * has focus
        * opacity
        * animation mode
      */
-    static QColor sidePanelOutlineColor(const StyleOptions &options);
+    static QColor sidePanelOutlineColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -110,7 +154,7 @@ public:
        * opacity
        * animation mode
      */
-    static QColor sliderOutlineColor(const StyleOptions &options);
+    static QColor sliderOutlineColor(const PaintOptions &options);
 
     // Background colors
 
@@ -123,7 +167,7 @@ public:
        * animation mode
        * color variant
      */
-    static QColor buttonBackgroundColor(const StyleOptions &options);
+    static QColor buttonBackgroundColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -132,12 +176,12 @@ public:
        * animation mode
        * color variant
      */
-    static QColor checkBoxIndicatorColor(const StyleOptions &options);
+    static QColor checkBoxIndicatorColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * state
      */
-    static QColor headerTextColor(const StyleOptions &options);
+    static QColor headerTextColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -149,11 +193,11 @@ public:
        * color variant
        * in menu
      */
-    static QColor indicatorBackgroundColor(const StyleOptions &options);
+    static QColor indicatorBackgroundColor(const PaintOptions &options);
     /* Relevant options:
        * palette
      */
-    static QColor frameBackgroundColor(const StyleOptions &options);
+    static QColor frameBackgroundColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -163,12 +207,12 @@ public:
        * animation mode
        * color variant
      */
-    static QColor scrollBarHandleColor(const StyleOptions &options);
+    static QColor scrollBarHandleColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * color variant
      */
-    static QColor separatorColor(const StyleOptions &options);
+    static QColor separatorColor(const PaintOptions &options);
     /* Relevant options:
        * palette
        * mouse over
@@ -177,10 +221,34 @@ public:
        * opacity
        * animation mode
      */
-    static QColor toolButtonColor(const StyleOptions &options);
+    static QColor toolButtonColor(const PaintOptions &options);
     /* Relevant options:
        * palette
      */
+    static QColor tabBarColor(const PaintOptions &options);
+
+    // StyleOptions overloads, forwarding to the PaintOptions ones
+    static QColor hoverColor(const StyleOptions &options);
+    static QColor focusColor(const StyleOptions &options);
+    static QColor negativeText(const StyleOptions &options);
+    static QColor shadowColor(const StyleOptions &options);
+    static QColor titleBarColor(const StyleOptions &options);
+    static QColor titleBarTextColor(const StyleOptions &options);
+    static QColor arrowOutlineColor(const StyleOptions &options);
+    static QColor buttonOutlineColor(const StyleOptions &options);
+    static QColor indicatorOutlineColor(const StyleOptions &options);
+    static QColor frameOutlineColor(const StyleOptions &options);
+    static QColor inputOutlineColor(const StyleOptions &options);
+    static QColor sidePanelOutlineColor(const StyleOptions &options);
+    static QColor sliderOutlineColor(const StyleOptions &options);
+    static QColor buttonBackgroundColor(const StyleOptions &options);
+    static QColor checkBoxIndicatorColor(const StyleOptions &options);
+    static QColor headerTextColor(const StyleOptions &options);
+    static QColor indicatorBackgroundColor(const StyleOptions &options);
+    static QColor frameBackgroundColor(const StyleOptions &options);
+    static QColor scrollBarHandleColor(const StyleOptions &options);
+    static QColor separatorColor(const StyleOptions &options);
+    static QColor toolButtonColor(const StyleOptions &options);
     static QColor tabBarColor(const StyleOptions &options);
 };
 }
@@ -0,0 +1,154 @@
+#include "graceful-pixmap-budget.h"
+
+#include "graceful.h"
+#include "csyslog.h"
+
+#include <QTimerEvent>
+#include <QGuiApplication>
+
+namespace Graceful {
+
+//____________________________________________________________
+PixmapBudget &PixmapBudget::instance()
+{
+    static PixmapBudget budget;
+
+    // application may not exist when first cache registers
+    if (!budget._connected && qApp) {
+        budget._connected = true;
+        connect(qApp, SIGNAL(applicationStateChanged(Qt::ApplicationState)), &budget, SLOT(applicationStateChanged(Qt::ApplicationState)));
+    }
+
+    return budget;
+}
+
+//____________________________________________________________
+PixmapBudget::PixmapBudget()
+    : _cap(qint64(Config::PixmapBudgetSize) * 1024)
+    , _clock(0)
+    , _connected(false)
+{
+    bool ok(false);
+    qint64 value(qgetenv("GRACEFUL_PIXMAP_BUDGET").toLongLong(&ok));
+    if (ok && value >= 0) {
+        _cap = value * 1024;
+    }
+}
+
+//____________________________________________________________
+void PixmapBudget::registerCache(Client *client, const QString &name, qint64 quota)
+{
+    Entry entry = { client, name, quota };
+    _entries.append(entry);
+}
+
+//____________________________________________________________
+void PixmapBudget::unregisterCache(Client *client)
+{
+    for (auto iter = _entries.begin(); iter != _entries.end(); ++iter) {
+        if (iter->client == client) {
+            _entries.erase(iter);
+            return;
+        }
+    }
+}
+
+//____________________________________________________________
+void PixmapBudget::enforce(Client *client)
+{
+    // cache quota
+    for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter) {
+        if (iter->client == client) {
+            while (client->bytes() > iter->quota && client->oldestStamp())
+                client->evictOldest();
+            break;
+        }
+    }
+
+    // global cap, evicting the oldest entry of all caches first
+    while (totalBytes() > _cap) {
+        Client *oldest(nullptr);
+        quint64 oldestStamp(0);
+        for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter) {
+            quint64 stamp(iter->client->oldestStamp());
+            if (stamp && (!oldest || stamp < oldestStamp)) {
+                oldest = iter->client;
+                oldestStamp = stamp;
+            }
+        }
+
+        if (!oldest)
+            break;
+
+        oldest->evictOldest();
+    }
+}
+
+//____________________________________________________________
+void PixmapBudget::trim()
+{
+    for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter)
+        iter->client->clear();
+}
+
+//____________________________________________________________
+qint64 PixmapBudget::totalBytes() const
+{
+    qint64 bytes(0);
+    for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter)
+        bytes += iter->client->bytes();
+
+    return bytes;
+}
+
+//____________________________________________________________
+QList<PixmapBudget::Usage> PixmapBudget::usage() const
+{
+    QList<Usage> out;
+    for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter) {
+        Usage usage = { iter->name, iter->client->bytes(), iter->quota, iter->client->hits(), iter->client->misses() };
+        out.append(usage);
+    }
+
+    return out;
+}
+
+//____________________________________________________________
+void PixmapBudget::report() const
+{
+    const QList<Usage> caches(usage());
+    for (auto iter = caches.constBegin(); iter != caches.constEnd(); ++iter) {
+        CT_SYSLOG(LOG_DEBUG, "%s: %lld/%lld bytes, %d hits, %d misses (%.1f%%)",
+                  iter->name.toUtf8().constData(), iter->bytes, iter->quota, iter->hits, iter->misses, 100 * iter->hitRate());
+    }
+
+    CT_SYSLOG(LOG_DEBUG, "total: %lld/%lld bytes", totalBytes(), _cap);
+}
+
+//____________________________________________________________
+void PixmapBudget::applicationStateChanged(Qt::ApplicationState state)
+{
+    // QEvent::ApplicationStateChange is reported through this signal,
+    // which avoids an application wide event filter.
+    // xcb only reports Active and Inactive. Trimming is delayed, so that switching focus
+    // back and forth does not rerender everything
+    if (state == Qt::ApplicationActive) {
+        _trimTimer.stop();
+    } else if (!_trimTimer.isActive()) {
+        _trimTimer.start(Config::PixmapBudgetTrimDelay, this);
+    }
+}
+
+//____________________________________________________________
+void PixmapBudget::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != _trimTimer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    _trimTimer.stop();
+    trim();
+}
+
+} // namespace Graceful
@@ -0,0 +1,139 @@
+#ifndef GRACEFUL_PIXMAP_BUDGET_H
+#define GRACEFUL_PIXMAP_BUDGET_H
+#include "graceful-export.h"
+
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QBasicTimer>
+
+namespace Graceful {
+
+/**
+ * single memory budget shared by all rendering caches.
+ * Each cache gets a byte quota; on top of it the sum of all caches is kept
+ * below a global cap by evicting the least recently used entry across all caches.
+ * The cap defaults to Config::PixmapBudgetSize and can be lowered or raised
+ * with the GRACEFUL_PIXMAP_BUDGET environment variable, in kilobytes.
+ */
+class GRACEFUL_EXPORT PixmapBudget : public QObject
+{
+    Q_OBJECT
+public:
+    //* cache registered with the budget
+    class GRACEFUL_EXPORT Client
+    {
+    public:
+        //* destructor
+        virtual ~Client()
+        {
+        }
+
+        //* bytes currently used
+        virtual qint64 bytes() const = 0;
+
+        //* access stamp of the least recently used entry. Zero if empty
+        virtual quint64 oldestStamp() const = 0;
+
+        //* evict the least recently used entry
+        virtual void evictOldest() = 0;
+
+        //* evict all entries
+        virtual void clear() = 0;
+
+        //* number of lookups that found an entry
+        virtual int hits() const = 0;
+
+        //* number of lookups that did not
+        virtual int misses() const = 0;
+    };
+
+    //* usage of a registered cache
+    struct Usage {
+        QString name;
+        qint64 bytes;
+        qint64 quota;
+        int hits;
+        int misses;
+
+        //* ratio of lookups that found an entry
+        qreal hitRate() const
+        {
+            return hits + misses > 0 ? qreal(hits) / (hits + misses) : 0.0;
+        }
+    };
+
+    //* shared instance
+    static PixmapBudget &instance();
+
+    //* register cache, with given quota in bytes
+    void registerCache(Client *, const QString &name, qint64 quota);
+
+    //* unregister cache
+    void unregisterCache(Client *);
+
+    //* next access stamp. Stamps increase across all caches, which makes eviction globally LRU
+    quint64 nextStamp()
+    {
+        return ++_clock;
+    }
+
+    //* evict entries until given cache fits its quota and all caches fit the global cap
+    void enforce(Client *);
+
+    //* evict all entries of all caches
+    void trim();
+
+    //* global cap, in bytes
+    qint64 cap() const
+    {
+        return _cap;
+    }
+
+    //* bytes used by all caches
+    qint64 totalBytes() const;
+
+    //* per cache usage
+    QList<Usage> usage() const;
+
+    //* write per cache usage to the system log
+    void report() const;
+
+protected:
+    //* trim once the application has stayed inactive long enough
+    virtual void timerEvent(QTimerEvent *) override;
+
+private Q_SLOTS:
+    //* schedule a trim when application stops being active, cancel it when it comes back
+    void applicationStateChanged(Qt::ApplicationState);
+
+private:
+    //* constructor
+    explicit PixmapBudget();
+
+    //* registered cache
+    struct Entry {
+        Client *client;
+        QString name;
+        qint64 quota;
+    };
+
+    //* caches
+    QList<Entry> _entries;
+
+    //* global cap
+    qint64 _cap;
+
+    //* access clock
+    quint64 _clock;
+
+    //* delayed trim
+    QBasicTimer _trimTimer;
+
+    //* true once connected to the application
+    bool _connected;
+};
+
+} // namespace Graceful
+
+#endif // GRACEFUL_PIXMAP_BUDGET_H
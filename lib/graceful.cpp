@@ -1,96 +1,178 @@
 #include "graceful.h"
+#include "graceful-colors.h"
 
 #include "animations/graceful-animations.h"
 
 namespace Graceful
 {
 
+//* overwrite palette with the theme colors
+static void applyThemeColors(QPalette &palette, ColorVariant variant)
+{
+    QColor  window_bg(231,231,231),
+            window_no_bg(233,233,233),
+            base_bg(255,255,255),
+            base_no_bg(248, 248, 248),
+            font_bg(0,0,0),
+            font_br_bg(255,255,255),
+            font_di_bg(191,191,191),
+            button_bg(217,217,217),
+            button_ac_bg(107,142,235),
+            button_di_bg(233,233,233),
+            highlight_bg(61,107,229),
+            tip_bg(248,248,248),
+            tip_font(22,22,22),
+            alternateBase(248,248,248);
+
+    if (GracefulDark == variant) {
+        window_bg.setRgb(45,46,50);
+        window_no_bg.setRgb(48,46,50);
+        base_bg.setRgb(31,32,34);
+        base_no_bg.setRgb(28,28,30);
+        font_bg.setRgb(255,255,255);
+        font_bg.setAlphaF(0.9);
+        font_br_bg.setRgb(255,255,255);
+        font_br_bg.setAlphaF(0.9);
+        font_di_bg.setRgb(255,255,255);
+        font_di_bg.setAlphaF(0.3);
+        button_bg.setRgb(61,61,65);
+        button_ac_bg.setRgb(48,48,51);
+        button_di_bg.setRgb(48,48,51);
+        highlight_bg.setRgb(61,107,229);
+        tip_bg.setRgb(61,61,65);
+        tip_font.setRgb(232,232,232);
+        alternateBase.setRgb(36,35,40);
+    }
+
+    palette.setBrush(QPalette::Window,window_bg);
+    palette.setBrush(QPalette::Active,QPalette::Window,window_bg);
+    palette.setBrush(QPalette::Inactive,QPalette::Window,window_no_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::Window,window_no_bg);
+    palette.setBrush(QPalette::WindowText,font_bg);
+    palette.setBrush(QPalette::Active,QPalette::WindowText,font_bg);
+    palette.setBrush(QPalette::Inactive,QPalette::WindowText,font_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::WindowText,font_di_bg);
+
+    palette.setBrush(QPalette::Base,base_bg);
+    palette.setBrush(QPalette::Active,QPalette::Base,base_bg);
+    palette.setBrush(QPalette::Inactive,QPalette::Base,base_no_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::Base,base_no_bg);
+    palette.setBrush(QPalette::Text,font_bg);
+    palette.setBrush(QPalette::Active,QPalette::Text,font_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::Text,font_di_bg);
+
+    //Cursor placeholder
+#if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
+    palette.setBrush(QPalette::PlaceholderText,font_di_bg);
+#endif
+
+    palette.setBrush(QPalette::ToolTipBase,tip_bg);
+    palette.setBrush(QPalette::ToolTipText,tip_font);
+
+    palette.setBrush(QPalette::Highlight,highlight_bg);
+    palette.setBrush(QPalette::Active,QPalette::Highlight,highlight_bg);
+    palette.setBrush(QPalette::HighlightedText,font_br_bg);
+
+    palette.setBrush(QPalette::BrightText,font_br_bg);
+    palette.setBrush(QPalette::Active,QPalette::BrightText,font_br_bg);
+    palette.setBrush(QPalette::Inactive,QPalette::BrightText,font_br_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::BrightText,font_di_bg);
+
+    palette.setBrush(QPalette::Button,button_bg);
+    palette.setBrush(QPalette::Active,QPalette::Button,button_bg);
+    palette.setBrush(QPalette::Inactive,QPalette::Button,button_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::Button,button_di_bg);
+    palette.setBrush(QPalette::ButtonText,font_bg);
+    palette.setBrush(QPalette::Inactive,QPalette::ButtonText,font_bg);
+    palette.setBrush(QPalette::Disabled,QPalette::ButtonText,font_di_bg);
+
+    palette.setBrush(QPalette::AlternateBase,alternateBase);
+    palette.setBrush(QPalette::Inactive,QPalette::AlternateBase,alternateBase);
+    palette.setBrush(QPalette::Disabled,QPalette::AlternateBase,button_di_bg);
+}
+
+//* true if role is overwritten by applyThemeColors, in all color groups
+static bool isThemeRole(QPalette::ColorRole role)
+{
+    switch (role) {
+    case QPalette::Window:
+    case QPalette::WindowText:
+    case QPalette::Base:
+    case QPalette::Text:
+#if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
+    case QPalette::PlaceholderText:
+#endif
+    case QPalette::ToolTipBase:
+    case QPalette::ToolTipText:
+    case QPalette::Highlight:
+    case QPalette::HighlightedText:
+    case QPalette::BrightText:
+    case QPalette::Button:
+    case QPalette::ButtonText:
+    case QPalette::AlternateBase:
+        return true;
+    default:
+        return false;
+    }
+}
+
+//* theme colors, shared by all options
+static const QPalette &themePalette()
+{
+    static const QPalette palette(PaintOptions::themedPalette(QPalette()));
+    return palette;
+}
+
+PaintOptions::PaintOptions(const QPalette &palette)
+    : mPalette(&palette)
+    , mColorGroup(QPalette::Normal)
+    , mColorRole(QPalette::Base)
+    , mColorVariant(ColorVariant::Unknown)
+    , mResolvedColorVariant(Colors::resolveColorVariant(ColorVariant::Unknown))
+    , mActive(false)
+    , mFocus(false)
+    , mMouseHover(false)
+    , mOpacity(AnimationData::OpacityInvalid)
+    , mAnimationMode(AnimationNone)
+    , mCheckboxState(CheckOff)
+    , mState(QStyle::State_None)
+    , mInMenu(false)
+    , mSunken(false)
+{
+
+}
+
+void PaintOptions::setColorVariant(ColorVariant variant)
+{
+    mColorVariant = variant;
+    mResolvedColorVariant = Colors::resolveColorVariant(variant);
+}
+
+QColor PaintOptions::color(QPalette::ColorGroup group, QPalette::ColorRole role) const
+{
+    if (group == QPalette::Current) {
+        group = mPalette->currentColorGroup();
+    }
+
+    return isThemeRole(role) ? themePalette().color(group, role) : mPalette->color(group, role);
+}
+
+QPalette PaintOptions::themedPalette(const QPalette &palette)
+{
+    // theme colors are applied before any color variant is set on the options
+    QPalette copy(palette);
+    applyThemeColors(copy, ColorVariant::Unknown);
+    return copy;
+}
+
 class StyleOptionsPrivate
 {
 public:
     explicit StyleOptionsPrivate(const QPalette &palette)
         : mPalette(palette)
+        , mOptions(mPalette)
     {
-        QColor  window_bg(231,231,231),
-                window_no_bg(233,233,233),
-                base_bg(255,255,255),
-                base_no_bg(248, 248, 248),
-                font_bg(0,0,0),
-                font_br_bg(255,255,255),
-                font_di_bg(191,191,191),
-                button_bg(217,217,217),
-                button_ac_bg(107,142,235),
-                button_di_bg(233,233,233),
-                highlight_bg(61,107,229),
-                tip_bg(248,248,248),
-                tip_font(22,22,22),
-                alternateBase(248,248,248);
-
-        if (GracefulDark == mColorVariant) {
-            window_bg.setRgb(45,46,50);
-            window_no_bg.setRgb(48,46,50);
-            base_bg.setRgb(31,32,34);
-            base_no_bg.setRgb(28,28,30);
-            font_bg.setRgb(255,255,255);
-            font_bg.setAlphaF(0.9);
-            font_br_bg.setRgb(255,255,255);
-            font_br_bg.setAlphaF(0.9);
-            font_di_bg.setRgb(255,255,255);
-            font_di_bg.setAlphaF(0.3);
-            button_bg.setRgb(61,61,65);
-            button_ac_bg.setRgb(48,48,51);
-            button_di_bg.setRgb(48,48,51);
-            highlight_bg.setRgb(61,107,229);
-            tip_bg.setRgb(61,61,65);
-            tip_font.setRgb(232,232,232);
-            alternateBase.setRgb(36,35,40);
-        }
-
-        mPalette.setBrush(QPalette::Window,window_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::Window,window_bg);
-        mPalette.setBrush(QPalette::Inactive,QPalette::Window,window_no_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::Window,window_no_bg);
-        mPalette.setBrush(QPalette::WindowText,font_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::WindowText,font_bg);
-        mPalette.setBrush(QPalette::Inactive,QPalette::WindowText,font_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::WindowText,font_di_bg);
-
-        mPalette.setBrush(QPalette::Base,base_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::Base,base_bg);
-        mPalette.setBrush(QPalette::Inactive,QPalette::Base,base_no_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::Base,base_no_bg);
-        mPalette.setBrush(QPalette::Text,font_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::Text,font_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::Text,font_di_bg);
-
-        //Cursor placeholder
-#if (QT_VERSION >= QT_VERSION_CHECK(5,12,0))
-        mPalette.setBrush(QPalette::PlaceholderText,font_di_bg);
-#endif
 
-        mPalette.setBrush(QPalette::ToolTipBase,tip_bg);
-        mPalette.setBrush(QPalette::ToolTipText,tip_font);
-
-        mPalette.setBrush(QPalette::Highlight,highlight_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::Highlight,highlight_bg);
-        mPalette.setBrush(QPalette::HighlightedText,font_br_bg);
-
-        mPalette.setBrush(QPalette::BrightText,font_br_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::BrightText,font_br_bg);
-        mPalette.setBrush(QPalette::Inactive,QPalette::BrightText,font_br_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::BrightText,font_di_bg);
-
-        mPalette.setBrush(QPalette::Button,button_bg);
-        mPalette.setBrush(QPalette::Active,QPalette::Button,button_bg);
-        mPalette.setBrush(QPalette::Inactive,QPalette::Button,button_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::Button,button_di_bg);
-        mPalette.setBrush(QPalette::ButtonText,font_bg);
-        mPalette.setBrush(QPalette::Inactive,QPalette::ButtonText,font_bg);
-        mPalette.setBrush(QPalette::Disabled,QPalette::ButtonText,font_di_bg);
-
-        mPalette.setBrush(QPalette::AlternateBase,alternateBase);
-        mPalette.setBrush(QPalette::Inactive,QPalette::AlternateBase,alternateBase);
-        mPalette.setBrush(QPalette::Disabled,QPalette::AlternateBase,button_di_bg);
     }
     virtual ~StyleOptionsPrivate()
     {
@@ -98,18 +180,7 @@ public:
     }
 
     QPalette mPalette;
-    QPalette::ColorGroup mColorGroup = QPalette::ColorGroup::Normal;
-    QPalette::ColorRole mColorRole = QPalette::ColorRole::Base;
-    ColorVariant mColorVariant = ColorVariant::Unknown;
-    bool mActive = false;
-    bool mFocus = false;
-    bool mMouseHover = false;
-    qreal mOpacity = AnimationData::OpacityInvalid;
-    AnimationMode mAnimationMode = AnimationNone;
-    CheckBoxState mCheckboxState = CheckOff;
-    QStyle::State mState = QStyle::State_None;
-    bool mInMenu = false;
-    bool mSunken = false;
+    PaintOptions mOptions;
 };
 
 StyleOptions::StyleOptions(const QPalette &palette)
@@ -127,98 +198,98 @@ QPalette StyleOptions::palette() const
 {
     Q_D(const StyleOptions);
 
-    return d->mPalette;
+    return PaintOptions::themedPalette(d->mPalette);
 }
 
 void StyleOptions::setColorGroup(QPalette::ColorGroup group)
 {
     Q_D(StyleOptions);
 
-    d->mColorGroup = group;
+    d->mOptions.setColorGroup(group);
 }
 
 QPalette::ColorGroup StyleOptions::colorGroup() const
 {
     Q_D(const StyleOptions);
 
-    return d->mColorGroup;
+    return d->mOptions.colorGroup();
 }
 
 void StyleOptions::setColorRole(QPalette::ColorRole role)
 {
     Q_D(StyleOptions);
 
-    d->mColorRole = role;
+    d->mOptions.setColorRole(role);
 }
 
 QPalette::ColorRole StyleOptions::colorRole() const
 {
     Q_D(const StyleOptions);
 
-    return d->mColorRole;
+    return d->mOptions.colorRole();
 }
 
 void StyleOptions::setColorVariant(ColorVariant variant)
 {
     Q_D(StyleOptions);
 
-    d->mColorVariant = variant;
+    d->mOptions.setColorVariant(variant);
 }
 
 ColorVariant StyleOptions::colorVariant() const
 {
     Q_D(const StyleOptions);
 
-    return d->mColorVariant;
+    return d->mOptions.colorVariant();
 }
 
 void StyleOptions::setActive(bool active)
 {
     Q_D(StyleOptions);
 
-    d->mActive = active;
+    d->mOptions.setActive(active);
 }
 
 bool StyleOptions::active() const
 {
     Q_D(const StyleOptions);
 
-    return d->mActive;
+    return d->mOptions.active();
 }
 
 void StyleOptions::setHasFocus(bool focus)
 {
     Q_D(StyleOptions);
 
-    d->mFocus = focus;
+    d->mOptions.setHasFocus(focus);
 }
 
 bool StyleOptions::hasFocus() const
 {
     Q_D(const StyleOptions);
 
-    return d->mFocus;
+    return d->mOptions.hasFocus();
 }
 
 void StyleOptions::setMouseOver(bool mouseOver)
 {
     Q_D(StyleOptions);
 
-    d->mMouseHover = mouseOver;
+    d->mOptions.setMouseOver(mouseOver);
 }
 
 bool StyleOptions::mouseOver() const
 {
     Q_D(const StyleOptions);
 
-    return d->mMouseHover;
+    return d->mOptions.mouseOver();
 }
 
 void StyleOptions::setOpacity(qreal opacity)
 {
     Q_D(StyleOptions);
 
-    d->mOpacity = opacity;
+    d->mOptions.setOpacity(opacity);
 }
 
 qreal StyleOptions::opacity() const
@@ -226,7 +297,7 @@ qreal StyleOptions::opacity() const
 
     Q_D(const StyleOptions);
 
-    return d->mOpacity;
+    return d->mOptions.opacity();
 }
 
 void StyleOptions::setAnimationMode(AnimationMode mode)
@@ -234,7 +305,7 @@ void StyleOptions::setAnimationMode(AnimationMode mode)
 
     Q_D(StyleOptions);
 
-    d->mAnimationMode = mode;
+    d->mOptions.setAnimationMode(mode);
 }
 
 AnimationMode StyleOptions::animationMode() const
@@ -242,7 +313,7 @@ AnimationMode StyleOptions::animationMode() const
 
     Q_D(const StyleOptions);
 
-    return d->mAnimationMode;
+    return d->mOptions.animationMode();
 }
 
 void StyleOptions::setCheckboxState(CheckBoxState state)
@@ -250,7 +321,7 @@ void StyleOptions::setCheckboxState(CheckBoxState state)
 
     Q_D(StyleOptions);
 
-    d->mCheckboxState = state;
+    d->mOptions.setCheckboxState(state);
 }
 
 CheckBoxState StyleOptions::checkboxState() const
@@ -258,7 +329,7 @@ CheckBoxState StyleOptions::checkboxState() const
 
     Q_D(const StyleOptions);
 
-    return d->mCheckboxState;
+    return d->mOptions.checkboxState();
 }
 
 void StyleOptions::setState(QStyle::State state)
@@ -266,7 +337,7 @@ void StyleOptions::setState(QStyle::State state)
 
     Q_D(StyleOptions);
 
-    d->mState = state;
+    d->mOptions.setState(state);
 }
 
 QStyle::State StyleOptions::state() const
@@ -274,7 +345,7 @@ QStyle::State StyleOptions::state() const
 
     Q_D(const StyleOptions);
 
-    return d->mState;
+    return d->mOptions.state();
 }
 
 void StyleOptions::setInMenu(bool inMenu)
@@ -282,7 +353,7 @@ void StyleOptions::setInMenu(bool inMenu)
 
     Q_D(StyleOptions);
 
-    d->mInMenu = inMenu;
+    d->mOptions.setInMenu(inMenu);
 }
 
 bool StyleOptions::inMenu() const
@@ -290,7 +361,7 @@ bool StyleOptions::inMenu() const
 
     Q_D(const StyleOptions);
 
-    return d->mInMenu;
+    return d->mOptions.inMenu();
 }
 
 void StyleOptions::setSunken(bool sunken)
@@ -298,7 +369,7 @@ void StyleOptions::setSunken(bool sunken)
 
     Q_D(StyleOptions);
 
-    d->mSunken = sunken;
+    d->mOptions.setSunken(sunken);
 }
 
 bool StyleOptions::sunken() const
@@ -306,7 +377,14 @@ bool StyleOptions::sunken() const
 
     Q_D(const StyleOptions);
 
-    return d->mSunken;
+    return d->mOptions.sunken();
+}
+
+const PaintOptions &StyleOptions::paintOptions() const
+{
+    Q_D(const StyleOptions);
+
+    return d->mOptions;
 }
 
 }
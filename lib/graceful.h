@@ -53,6 +53,9 @@ namespace Config
     const int AnimationsDuration {180};
     const bool AnimationsEnabled {true};
 
+    // Interval between animation frames, in milliseconds
+    const int AnimationFrameInterval {16};
+
     const int ScrollBarAddLineButtons {0};
     const int ScrollBarSubLineButtons {0};
     const bool ScrollBarShowOnMouseOver {true};
@@ -74,6 +77,35 @@ namespace Config
     const bool MenuItemDrawStrongFocus {true};
 
     const bool DrawWidgetRects {false};
+
+    // Pixmap caches, in kilobytes. All caches together are capped by PixmapBudgetSize
+    const int PixmapBudgetSize {8192};
+    const int ButtonFrameCacheSize {2048};
+    const int FrameTileCacheSize {512};
+    const int RoundedPathCacheSize {256};
+    const int IndicatorAtlasCacheSize {1024};
+    const int ArrowCacheSize {128};
+    const int BusyIndicatorCacheSize {64};
+    const int IconPixmapCacheSize {256};
+
+    // Delay before all caches are trimmed once the application is no longer active, in milliseconds
+    const int PixmapBudgetTrimDelay {30000};
+
+    // Standard icons, in icons. Their pixmaps are rendered on demand and charged to IconPixmapCacheSize
+    const int IconCacheSize {64};
+    const bool IconCachePersistent {false};
+
+    // Persisted icons of other builds are dropped once unused for that many days
+    const int IconCacheMaxAge {30};
+
+    // Persisted icons of the current build, in files. The least recently written ones are dropped past it
+    const int IconCacheMaxFiles {512};
+
+    // Palettes blended during enable/disable transitions, in palettes. Not part of the pixmap budget
+    const int DisabledPaletteCacheSize {32};
+
+    // Number of pre-rendered frames for checkbox and radio button animations
+    const int IndicatorAnimationFrames {8};
     const QStringList WindowDragWhiteList;
     const QStringList WindowDragBlackList;
 
@@ -240,7 +272,8 @@ enum AnimationMode
     AnimationHover                      = 0x1,
     AnimationFocus                      = 0x2,
     AnimationEnable                     = 0x4,
-    AnimationPressed                    = 0x8
+    AnimationPressed                    = 0x8,
+    AnimationSubControlHover            = 0x10
 };
 Q_DECLARE_FLAGS(AnimationModes, AnimationMode)
 
@@ -315,8 +348,116 @@ enum ColorVariant
     GracefulHighcontrast
 };
 
+/**
+ * lightweight color options, used on the paint path.
+ * References the caller's palette rather than copying it, so it must not outlive it.
+ * The theme colors StyleOptions used to write into its palette copy are looked up
+ * from a shared palette instead
+ */
+class GRACEFUL_EXPORT PaintOptions
+{
+public:
+    explicit PaintOptions(const QPalette &palette);
+
+    //* source palette
+    const QPalette &sourcePalette() const
+    { return *mPalette; }
+
+    //* color of a given role, with theme colors applied
+    QColor color(QPalette::ColorGroup group, QPalette::ColorRole role) const;
+    QColor color(QPalette::ColorRole role) const
+    { return color(QPalette::Current, role); }
+
+    QPalette::ColorGroup currentColorGroup() const
+    { return mPalette->currentColorGroup(); }
+
+    void setColorGroup(QPalette::ColorGroup group)
+    { mColorGroup = group; }
+    QPalette::ColorGroup colorGroup() const
+    { return mColorGroup; }
+
+    void setColorRole(QPalette::ColorRole role)
+    { mColorRole = role; }
+    QPalette::ColorRole colorRole() const
+    { return mColorRole; }
+
+    void setColorVariant(ColorVariant variant);
+    ColorVariant colorVariant() const
+    { return mColorVariant; }
+
+    //* color variant, with Unknown resolved against the application palette
+    ColorVariant resolvedColorVariant() const
+    { return mResolvedColorVariant; }
+
+    void setActive(bool active)
+    { mActive = active; }
+    bool active() const
+    { return mActive; }
+
+    void setHasFocus(bool focus)
+    { mFocus = focus; }
+    bool hasFocus() const
+    { return mFocus; }
+
+    void setMouseOver(bool mouseOver)
+    { mMouseHover = mouseOver; }
+    bool mouseOver() const
+    { return mMouseHover; }
+
+    void setOpacity(qreal opacity)
+    { mOpacity = opacity; }
+    qreal opacity() const
+    { return mOpacity; }
+
+    void setAnimationMode(AnimationMode mode)
+    { mAnimationMode = mode; }
+    AnimationMode animationMode() const
+    { return mAnimationMode; }
+
+    void setCheckboxState(CheckBoxState state)
+    { mCheckboxState = state; }
+    CheckBoxState checkboxState() const
+    { return mCheckboxState; }
+
+    void setState(QStyle::State state)
+    { mState = state; }
+    QStyle::State state() const
+    { return mState; }
+
+    void setInMenu(bool inMenu)
+    { mInMenu = inMenu; }
+    bool inMenu() const
+    { return mInMenu; }
+
+    void setSunken(bool sunken)
+    { mSunken = sunken; }
+    bool sunken() const
+    { return mSunken; }
+
+    //* palette with theme colors applied. This copies the palette, avoid on the paint path
+    static QPalette themedPalette(const QPalette &palette);
+
+private:
+    const QPalette *mPalette;
+    QPalette::ColorGroup mColorGroup;
+    QPalette::ColorRole mColorRole;
+    ColorVariant mColorVariant;
+    ColorVariant mResolvedColorVariant;
+    bool mActive;
+    bool mFocus;
+    bool mMouseHover;
+    qreal mOpacity;
+    AnimationMode mAnimationMode;
+    CheckBoxState mCheckboxState;
+    QStyle::State mState;
+    bool mInMenu;
+    bool mSunken;
+};
+
 class StyleOptionsPrivate;
 
+//* compatibility wrapper around PaintOptions, owning a copy of the palette
+
 class GRACEFUL_EXPORT StyleOptions
 {
 public:
@@ -361,6 +502,8 @@ public:
     void setSunken(bool sunken);
     bool sunken() const;
 
+    const PaintOptions &paintOptions() const;
+
 private:
     Q_DECLARE_PRIVATE(StyleOptions)
 
@@ -372,5 +515,7 @@ Q_DECLARE_OPERATORS_FOR_FLAGS(Graceful::Sides)
 Q_DECLARE_OPERATORS_FOR_FLAGS(Graceful::Corners)
 Q_DECLARE_OPERATORS_FOR_FLAGS(Graceful::AnimationModes)
 
+Q_DECLARE_TYPEINFO(Graceful::PaintOptions, Q_MOVABLE_TYPE);
+
 
 #endif // GRACEFUL_H
@@ -42,14 +42,15 @@ HEADERS             += \
     $$PWD/graceful-splitter-proxy.h                         \
     $$PWD/graceful-widget-explorer.h                        \
     $$PWD/graceful-add-event-filter.h                       \
+    $$PWD/graceful-pixmap-budget.h                          \
     $$PWD/animations/graceful-datamap.h                     \
     $$PWD/animations/graceful-dial-data.h                   \
     $$PWD/animations/graceful-animation.h                   \
+    $$PWD/animations/graceful-frame-clock.h                 \
     $$PWD/animations/graceful-animations.h                  \
     $$PWD/animations/graceful-tabbar-data.h                 \
     $$PWD/animations/graceful-base-engine.h                 \
     $$PWD/animations/graceful-dial-engine.h                 \
-    $$PWD/animations/graceful-enable-data.h                 \
     $$PWD/animations/graceful-generic-data.h                \
     $$PWD/animations/graceful-spinbox-data.h                \
     $$PWD/animations/graceful-tabbar-engine.h               \
@@ -79,13 +80,14 @@ SOURCES             += \
     $$PWD/graceful-window-manager.cpp                       \
     $$PWD/graceful-widget-explorer.cpp                      \
     $$PWD/graceful-add-event-filter.cpp                     \
+    $$PWD/graceful-pixmap-budget.cpp                        \
     $$PWD/animations/graceful-dial-data.cpp                 \
     $$PWD/animations/graceful-animation.cpp                 \
+    $$PWD/animations/graceful-frame-clock.cpp               \
     $$PWD/animations/graceful-animations.cpp                \
     $$PWD/animations/graceful-tabbar-data.cpp               \
     $$PWD/animations/graceful-base-engine.cpp               \
     $$PWD/animations/graceful-dial-engine.cpp               \
-    $$PWD/animations/graceful-enable-data.cpp               \
     $$PWD/animations/graceful-generic-data.cpp              \
     $$PWD/animations/graceful-spinbox-data.cpp              \
     $$PWD/animations/graceful-tabbar-engine.cpp             \
@@ -3,7 +3,9 @@
 #include "graceful.h"
 #include "csyslog.h"
 #include "graceful-colors.h"
+#include "graceful-painter-state-guard.h"
 
+#include <QtMath>
 #include <QPainter>
 #include <QLibrary>
 #include <QApplication>
@@ -21,8 +23,18 @@ namespace Graceful
 
 static const qreal arrowShade = 0.15;
 
+//* size of cached arrow sprites, large enough for the arrow polygon and its pen
+static const int arrowSpriteSize = 12;
+
 //____________________________________________________________________
 Helper::Helper()
+    : _buttonFrameCache(QStringLiteral("button frames"), Config::ButtonFrameCacheSize)
+    , _frameTileCache(QStringLiteral("frame tiles"), Config::FrameTileCacheSize)
+    , _roundedPathCache(QStringLiteral("rounded paths"), Config::RoundedPathCacheSize)
+    , _indicatorAtlasCache(QStringLiteral("indicators"), Config::IndicatorAtlasCacheSize)
+    , _arrowCache(QStringLiteral("arrows"), Config::ArrowCacheSize)
+    , _busyIndicatorCache(QStringLiteral("busy indicators"), Config::BusyIndicatorCacheSize)
+    , _iconPixmapCache(QStringLiteral("icon pixmaps"), Config::IconPixmapCacheSize)
 {
 
     init();
@@ -42,12 +54,20 @@ bool Helper::isWindowActive(const QWidget *widget)
 void Helper::renderDebugFrame(QPainter *painter, const QRect &rect) const
 {
 
-    painter->save();
+    // one pixel wide outline along the inside of rect
+    if (isPixelAligned(painter)) {
+        painter->fillRect(QRect(rect.left(), rect.top(), rect.width(), 1), Qt::red);
+        painter->fillRect(QRect(rect.left(), rect.bottom(), rect.width(), 1), Qt::red);
+        painter->fillRect(QRect(rect.left(), rect.top() + 1, 1, rect.height() - 2), Qt::red);
+        painter->fillRect(QRect(rect.right(), rect.top() + 1, 1, rect.height() - 2), Qt::red);
+        return;
+    }
+
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen);
     painter->setRenderHints(QPainter::Antialiasing);
     painter->setBrush(Qt::NoBrush);
     painter->setPen(Qt::red);
     painter->drawRect(QRectF(rect).adjusted(0.5, 0.5, -0.5, -0.5));
-    painter->restore();
 }
 
 //______________________________________________________________________________
@@ -94,7 +114,7 @@ void Helper::renderFocusLine(QPainter *painter, const QRect &rect, const QColor
     if (!color.isValid())
         return;
 
-    painter->save();
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen);
 
     QPen pen(color, 1);
     pen.setStyle(Qt::DotLine);
@@ -104,12 +124,70 @@ void Helper::renderFocusLine(QPainter *painter, const QRect &rect, const QColor
     painter->setBrush(Qt::NoBrush);
 
     painter->drawRoundedRect(rect, 1, 1);
-
-    painter->restore();
 }
 
 //______________________________________________________________________________
 void Helper::renderFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool hasFocus) const
+{
+    if (!renderFrameTileSet(painter, rect, GenericFrame, color, outline, hasFocus, AllCorners))
+        drawFrame(painter, rect, GenericFrame, color, outline, hasFocus, AllCorners);
+}
+
+//______________________________________________________________________________
+bool Helper::renderFrameTileSet(QPainter *painter, const QRect &rect, FrameType type, const QColor &color, const QColor &outline, bool hasFocus, Corners corners) const
+{
+    // edges are sliced one logical pixel wide, which needs the integer scale canUsePixmapCache checks for
+    if (!canUsePixmapCache(painter))
+        return false;
+
+    qreal dpiRatio(devicePixelRatio(painter));
+
+    // corners hold the margin, the rounded outline and a focus pen.
+    // Flat frames are the union of a rounded rect and a rect offset by twice the radius,
+    // only uniform horizontally past three radii
+    int cornerHeight(qCeil(frameRadius()) + 3);
+    int cornerWidth(type == FlatFrame ? qCeil(3 * frameRadius()) + 3 : cornerHeight);
+    QSize size(2 * cornerWidth + 1, 2 * cornerHeight + 1);
+    if (rect.width() < size.width() || rect.height() < size.height())
+        return false;
+
+    CacheKey key(type);
+    key << color << outline << hasFocus << int(corners) << dpiRatio;
+
+    TileSet tileSet;
+    if (!_frameTileCache.find(key, tileSet)) {
+        QPixmap pixmap(cachePixmap(painter, size));
+
+        QPainter localPainter(&pixmap);
+        drawFrame(&localPainter, QRect(QPoint(), size), type, color, outline, hasFocus, corners);
+        localPainter.end();
+
+        tileSet = TileSet(pixmap, cornerWidth, cornerHeight, color);
+        _frameTileCache.insert(key, tileSet);
+    }
+
+    tileSet.render(rect, painter);
+    return true;
+}
+
+//______________________________________________________________________________
+void Helper::drawFrame(QPainter *painter, const QRect &rect, FrameType type, const QColor &color, const QColor &outline, bool hasFocus, Corners corners) const
+{
+    switch (type) {
+    case FlatFrame:
+        drawFlatFrame(painter, rect, color, outline, hasFocus);
+        break;
+    case TabWidgetFrame:
+        drawTabWidgetFrame(painter, rect, color, outline, corners);
+        break;
+    default:
+        drawGenericFrame(painter, rect, color, outline, hasFocus);
+        break;
+    }
+}
+
+//______________________________________________________________________________
+void Helper::drawGenericFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool hasFocus) const
 {
     painter->setRenderHint(QPainter::Antialiasing);
 
@@ -155,6 +233,13 @@ void Helper::renderSquareFrame(QPainter *painter, const QRect &rect, QColor colo
 
 //______________________________________________________________________________
 void Helper::renderFlatFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool hasFocus) const
+{
+    if (!renderFrameTileSet(painter, rect, FlatFrame, color, outline, hasFocus, AllCorners))
+        drawFlatFrame(painter, rect, color, outline, hasFocus);
+}
+
+//______________________________________________________________________________
+void Helper::drawFlatFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool hasFocus) const
 {
     painter->setRenderHint(QPainter::Antialiasing);
 
@@ -258,6 +343,46 @@ void Helper::renderMenuFrame(QPainter *painter, const QRect &rect, const QColor
 //______________________________________________________________________________
 void Helper::renderButtonFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, const QColor &shadow,
                                bool hasFocus, bool sunken, bool mouseOver, bool active, bool darkMode) const
+{
+    if (!canUsePixmapCache(painter) || rect.isEmpty()) {
+        drawButtonFrame(painter, rect, color, outline, sunken, mouseOver, active, darkMode);
+        return;
+    }
+
+    // frame only depends on its size, colors and state. Shadow and focus are not drawn, and stay out of the key
+    CacheKey key;
+    key << rect.size() << color << outline << sunken << mouseOver << active << darkMode << devicePixelRatio(painter);
+
+    QPixmap pixmap;
+    if (!_buttonFrameCache.find(key, pixmap)) {
+        pixmap = cachePixmap(painter, rect.size());
+
+        QPainter localPainter(&pixmap);
+        drawButtonFrame(&localPainter, QRect(QPoint(), rect.size()), color, outline, sunken, mouseOver, active, darkMode);
+        localPainter.end();
+
+        _buttonFrameCache.insert(key, pixmap);
+    }
+
+    painter->drawPixmap(rect.topLeft(), pixmap);
+}
+
+//______________________________________________________________________________
+QBrush Helper::gradientBrush(const QPointF &start, const QPointF &finalStop, const QColor &color0, const QColor &color1)
+{
+    // stops that end up as the same pixel color render exactly like a solid fill, which is much faster
+    if (color0.rgba() == color1.rgba()) {
+        return QBrush(color0);
+    }
+
+    QLinearGradient gradient(start, finalStop);
+    gradient.setColorAt(0, color0);
+    gradient.setColorAt(1, color1);
+    return QBrush(gradient);
+}
+
+//______________________________________________________________________________
+void Helper::drawButtonFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool sunken, bool mouseOver, bool active, bool darkMode) const
 {
     // setup painter
     painter->setRenderHint(QPainter::Antialiasing, true);
@@ -277,37 +402,37 @@ void Helper::renderButtonFrame(QPainter *painter, const QRect &rect, const QColo
 
     // content
     if (color.isValid() && active) {
-        QLinearGradient gradient(frameRect.bottomLeft(), frameRect.topLeft());
+        QColor stop0, stop1;
         if (sunken) {
             // Pressed button in normal and dark mode is not a gradient, just an image consting from same $color
-            gradient.setColorAt(0, color);
-            gradient.setColorAt(1, color);
+            stop0 = color;
+            stop1 = color;
         } else if (mouseOver) {
             if (darkMode) {
                 QColor baseColor = Colors::lighten(color, 0.01);
                 // Hovered button in dark mode is a gradient from $color to Colors::lighten(bg_color, 0.01)
-                gradient.setColorAt(0, Colors::lighten(baseColor, 0.01)); // FIXME not correct according to adwaita's _drawing.scss file, but looks more close than before
-                gradient.setColorAt(1, Colors::lighten(baseColor, 0.01));
+                stop0 = Colors::lighten(baseColor, 0.01); // FIXME not correct according to adwaita's _drawing.scss file, but looks more close than before
+                stop1 = Colors::lighten(baseColor, 0.01);
             } else {
                 QColor baseColor = color;
                 // Hovered button in normal mode is a gradient from $color to Colors::lighten(bg_color, 0.01)
-                gradient.setColorAt(0, color);
-                gradient.setColorAt(1, Colors::lighten(baseColor, 0.01));
+                stop0 = color;
+                stop1 = Colors::lighten(baseColor, 0.01);
             }
         } else {
             if (darkMode) {
                 QColor baseColor = Colors::lighten(color, 0.01);
                 // Normal button in dark mode is a gradient from $color to bg_color
-                gradient.setColorAt(0, color);
-                gradient.setColorAt(1, baseColor);
+                stop0 = color;
+                stop1 = baseColor;
             } else {
                 QColor baseColor = Colors::lighten(color, 0.04);
                 // Normal button in normal mode is a gradient from $color to bg_color
-                gradient.setColorAt(0, color);
-                gradient.setColorAt(1, baseColor);
+                stop0 = color;
+                stop1 = baseColor;
             }
         }
-        painter->setBrush(gradient);
+        painter->setBrush(gradientBrush(frameRect.bottomLeft(), frameRect.topLeft(), stop0, stop1));
     } else if (!active) {
         painter->setBrush(color);
     } else {
@@ -348,43 +473,43 @@ void Helper::renderCheckBoxFrame(QPainter *painter, const QRect &rect, const QCo
     if (inMenu || state == CheckOff) {
         // content
         if (color.isValid() && active) {
-            QLinearGradient gradient(frameRect.bottomLeft(), frameRect.topLeft());
+            QColor stop0, stop1;
             if (sunken) {
                 // Pressed-alt button in dark mode is not a gradient, just an image consting from same $color
                 if (darkMode) {
-                    gradient.setColorAt(0, color);
-                    gradient.setColorAt(1, color);
+                    stop0 = color;
+                    stop1 = color;
                 } else {
                     // Pressed-alt button in normal mode is not a gradient, just an image consting from same $color
-                    gradient.setColorAt(0, color);
-                    gradient.setColorAt(1, color);
+                    stop0 = color;
+                    stop1 = color;
                 }
             } else if (mouseOver) {
                 if (darkMode) {
                     QColor baseColor = color;
                     // Hovered-alt button in dark mode is a gradient from $color to Colors::darken(bg_color, 0.04)
-                    gradient.setColorAt(0, Colors::darken(baseColor, 0.04));
-                    gradient.setColorAt(1, color);
+                    stop0 = Colors::darken(baseColor, 0.04);
+                    stop1 = color;
                 } else {
                     QColor baseColor = Colors::darken(color, 0.09);
                     // Hovered-alt button in normal mode is a gradient from $color to Colors::lighten(bg_color, 0.04)
-                    gradient.setColorAt(0, color);                      // FIXME:
-                    gradient.setColorAt(1, Colors::lighten(baseColor, 0.04));   // should be vice-versa, but this way it seems to be more accurate
+                    stop0 = color;                      // FIXME:
+                    stop1 = Colors::lighten(baseColor, 0.04);   // should be vice-versa, but this way it seems to be more accurate
                 }
             } else {
                 if (darkMode) {
                     QColor baseColor = Colors::lighten(color, 0.03);
                     // Normal-alt button in dark mode is a gradient from $color to Colors::darken(bg_color, 0.06)
-                    gradient.setColorAt(0, Colors::darken(baseColor, 0.06));
-                    gradient.setColorAt(1, color);
+                    stop0 = Colors::darken(baseColor, 0.06);
+                    stop1 = color;
                 } else {
                     QColor baseColor = Colors::darken(color, 0.05);
                     // Normal-alt button in normal mode is a gradient from $color to bg_color
-                    gradient.setColorAt(0, baseColor);
-                    gradient.setColorAt(1, color);
+                    stop0 = baseColor;
+                    stop1 = color;
                 }
             }
-            painter->setBrush(gradient);
+            painter->setBrush(gradientBrush(frameRect.bottomLeft(), frameRect.topLeft(), stop0, stop1));
         } else if (!active) {
             painter->setBrush(color);
         } else {
@@ -392,10 +517,7 @@ void Helper::renderCheckBoxFrame(QPainter *painter, const QRect &rect, const QCo
         }
     } else {
         if (color.isValid()) {
-            QLinearGradient gradient(frameRect.bottomLeft(), frameRect.topLeft());
-            gradient.setColorAt(0, color);
-            gradient.setColorAt(1, Colors::lighten(color, 0.04));
-            painter->setBrush(gradient);
+            painter->setBrush(gradientBrush(frameRect.bottomLeft(), frameRect.topLeft(), color, Colors::lighten(color, 0.04)));
         } else {
             painter->setBrush(Qt::NoBrush);
         }
@@ -427,19 +549,19 @@ void Helper::renderFlatButtonFrame(QPainter *painter, const QRect &rect, const Q
 
     // content
     if (color.isValid()) {
-        QLinearGradient gradient(frameRect.topLeft(), frameRect.bottomLeft());
+        QColor stop0, stop1;
         //gradient.setColorAt( 0, color.darker( sunken ? 110 : (hasFocus|mouseOver) ? 85 : 100 ) );
         //gradient.setColorAt( 1, color.darker( sunken ? 130 : (hasFocus|mouseOver) ? 95 : 110 ) );
 
         if (!active) {
-            gradient.setColorAt(0, color);
+            stop0 = stop1 = color;
         } else if (sunken) {
-            gradient.setColorAt(0, color);
+            stop0 = stop1 = color;
         } else {
-            gradient.setColorAt(0, Colors::mix(color, Qt::white, 0.07));
-            gradient.setColorAt(1, Colors::mix(color, Qt::black, 0.1));
+            stop0 = Colors::mix(color, Qt::white, 0.07);
+            stop1 = Colors::mix(color, Qt::black, 0.1);
         }
-        painter->setBrush(gradient);
+        painter->setBrush(gradientBrush(frameRect.topLeft(), frameRect.bottomLeft(), stop0, stop1));
     } else
         painter->setBrush(Qt::NoBrush);
 
@@ -523,19 +645,25 @@ void Helper::renderToolBoxFrame(QPainter *painter, const QRect &rect, int tabWid
     path.lineTo(baseRect.width() - 1, baseRect.height() - 1);
 
     // render
-    painter->save();
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen | PainterStateGuard::Transform);
     painter->setRenderHints(QPainter::Antialiasing);
     painter->setBrush(Qt::NoBrush);
     painter->setPen(outline);
     painter->translate(baseRect.topLeft());
     painter->drawPath(path);
-    painter->restore();
 
     return;
 }
 
 //______________________________________________________________________________
 void Helper::renderTabWidgetFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, Corners corners) const
+{
+    if (!renderFrameTileSet(painter, rect, TabWidgetFrame, color, outline, false, corners))
+        drawTabWidgetFrame(painter, rect, color, outline, corners);
+}
+
+//______________________________________________________________________________
+void Helper::drawTabWidgetFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, Corners corners) const
 {
     painter->setRenderHint(QPainter::Antialiasing);
 
@@ -564,6 +692,11 @@ void Helper::renderTabWidgetFrame(QPainter *painter, const QRect &rect, const QC
 //______________________________________________________________________________
 void Helper::renderSelection(QPainter *painter, const QRect &rect, const QColor &color) const
 {
+    if (isPixelAligned(painter)) {
+        painter->fillRect(rect, color);
+        return;
+    }
+
     painter->setRenderHint(QPainter::Antialiasing);
     painter->setPen(Qt::NoPen);
     painter->setBrush(color);
@@ -573,7 +706,18 @@ void Helper::renderSelection(QPainter *painter, const QRect &rect, const QColor
 //______________________________________________________________________________
 void Helper::renderSeparator(QPainter *painter, const QRect &rect, const QColor &color, bool vertical) const
 {
-    painter->save();
+    // aliased one pixel lines, including both end points
+    if (isPixelAligned(painter)) {
+        if (vertical) {
+            painter->fillRect(QRect(rect.left() + rect.width() / 2, rect.top(), 1, rect.height()), color);
+        } else {
+            painter->fillRect(QRect(rect.left(), rect.top() + rect.height() / 2, rect.width(), 1), color);
+        }
+
+        return;
+    }
+
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen | PainterStateGuard::Transform);
     painter->setRenderHint(QPainter::Antialiasing, false);
     painter->setBrush(Qt::NoBrush);
     painter->setPen(color);
@@ -586,8 +730,6 @@ void Helper::renderSeparator(QPainter *painter, const QRect &rect, const QColor
         painter->drawLine(rect.topLeft(), rect.topRight());
     }
 
-    painter->restore();
-
     return;
 }
 
@@ -610,8 +752,51 @@ void Helper::renderCheckBoxBackground(QPainter *painter, const QRect &rect, cons
 void Helper::renderCheckBox(QPainter *painter, const QRect &rect, const QColor &background, const QColor &outline, const QColor &tickColor,
                             bool sunken, CheckBoxState state, bool mouseOver, qreal animation, bool active, bool darkMode, bool inMenu) const
 {
-    // setup painter
-    painter->save();
+    if (!canUseIndicatorAtlas(painter, rect)) {
+        drawCheckBox(painter, rect, background, outline, tickColor, sunken, state, mouseOver, animation, active, darkMode, inMenu);
+        return;
+    }
+
+    qreal slotAnimation(animation);
+    int slot(indicatorSlot(state, CheckAnimated, animation, slotAnimation));
+
+    CacheKey key(CheckAnimated);
+    key << background << outline << tickColor << sunken << mouseOver << active << darkMode << inMenu << rect.size() << devicePixelRatio(painter);
+
+    IndicatorAtlas *atlas(indicatorAtlas(painter, key, rect.size()));
+    if (!atlas) {
+        drawCheckBox(painter, rect, background, outline, tickColor, sunken, state, mouseOver, animation, active, darkMode, inMenu);
+        return;
+    }
+
+    QRect spriteRect(atlas->spriteRect(slot));
+    QPixmap pixmap;
+    if (atlas->isRendered(slot)) {
+        pixmap = atlas->pixmap();
+    } else {
+        // render in place, holding the only reference to the atlas pixmap so that painting does not copy it.
+        // Drawing may fill other caches and evict the atlas, hence the second lookup
+        pixmap.swap(atlas->pixmap());
+        QPainter localPainter(&pixmap);
+        drawCheckBox(&localPainter, spriteRect, background, outline, tickColor, sunken, state, mouseOver, slotAnimation, active, darkMode, inMenu);
+        localPainter.end();
+
+        if ((atlas = _indicatorAtlasCache.object(key))) {
+            atlas->pixmap() = pixmap;
+            atlas->setRendered(slot);
+        }
+    }
+
+    qreal dpiRatio(devicePixelRatio(pixmap));
+    painter->drawPixmap(QPointF(rect.topLeft()), pixmap, QRectF(QPointF(spriteRect.topLeft()) * dpiRatio, QSizeF(spriteRect.size()) * dpiRatio));
+}
+
+//______________________________________________________________________________
+void Helper::drawCheckBox(QPainter *painter, const QRect &rect, const QColor &background, const QColor &outline, const QColor &tickColor,
+                          bool sunken, CheckBoxState state, bool mouseOver, qreal animation, bool active, bool darkMode, bool inMenu) const
+{
+    // setup painter. Marks below that clip still save and restore the full state
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen);
     painter->setRenderHint(QPainter::Antialiasing, true);
 
     // copy rect and radius
@@ -673,8 +858,6 @@ void Helper::renderCheckBox(QPainter *painter, const QRect &rect, const QColor &
         painter->drawPath(path);
         painter->restore();
     }
-
-    painter->restore();
 }
 
 //______________________________________________________________________________
@@ -697,6 +880,49 @@ void Helper::renderRadioButtonBackground(QPainter *painter, const QRect &rect, c
 //______________________________________________________________________________
 void Helper::renderRadioButton(QPainter *painter, const QRect &rect, const QColor &background, const QColor &outline, const QColor &tickColor,
                                bool sunken, bool enabled, RadioButtonState state, qreal animation, bool mouseOver, bool darkMode, bool inMenu) const
+{
+    if (!canUseIndicatorAtlas(painter, rect)) {
+        drawRadioButton(painter, rect, background, outline, tickColor, sunken, enabled, state, animation, mouseOver, darkMode, inMenu);
+        return;
+    }
+
+    qreal slotAnimation(animation);
+    int slot(indicatorSlot(state, RadioAnimated, animation, slotAnimation));
+
+    CacheKey key(RadioAnimated);
+    key << background << outline << tickColor << sunken << enabled << mouseOver << darkMode << inMenu << rect.size() << devicePixelRatio(painter);
+
+    IndicatorAtlas *atlas(indicatorAtlas(painter, key, rect.size()));
+    if (!atlas) {
+        drawRadioButton(painter, rect, background, outline, tickColor, sunken, enabled, state, animation, mouseOver, darkMode, inMenu);
+        return;
+    }
+
+    QRect spriteRect(atlas->spriteRect(slot));
+    QPixmap pixmap;
+    if (atlas->isRendered(slot)) {
+        pixmap = atlas->pixmap();
+    } else {
+        // render in place, holding the only reference to the atlas pixmap so that painting does not copy it.
+        // Drawing may fill other caches and evict the atlas, hence the second lookup
+        pixmap.swap(atlas->pixmap());
+        QPainter localPainter(&pixmap);
+        drawRadioButton(&localPainter, spriteRect, background, outline, tickColor, sunken, enabled, state, slotAnimation, mouseOver, darkMode, inMenu);
+        localPainter.end();
+
+        if ((atlas = _indicatorAtlasCache.object(key))) {
+            atlas->pixmap() = pixmap;
+            atlas->setRendered(slot);
+        }
+    }
+
+    qreal dpiRatio(devicePixelRatio(pixmap));
+    painter->drawPixmap(QPointF(rect.topLeft()), pixmap, QRectF(QPointF(spriteRect.topLeft()) * dpiRatio, QSizeF(spriteRect.size()) * dpiRatio));
+}
+
+//______________________________________________________________________________
+void Helper::drawRadioButton(QPainter *painter, const QRect &rect, const QColor &background, const QColor &outline, const QColor &tickColor,
+                             bool sunken, bool enabled, RadioButtonState state, qreal animation, bool mouseOver, bool darkMode, bool inMenu) const
 {
     // setup painter
     painter->setRenderHint(QPainter::Antialiasing, true);
@@ -973,11 +1199,7 @@ void Helper::renderProgressBarBusyContents(QPainter *painter, const QRect &rect,
 {
     Q_UNUSED(reverse);
 
-    // setup painter
-    painter->setRenderHint(QPainter::Antialiasing, true);
-
     QRectF baseRect(rect);
-    qreal radius(0.25 * Metrics::ProgressBar_Thickness);
     QRectF contentRect;
     if (horizontal) {
         contentRect = QRect(baseRect.left(), baseRect.top(), Metrics::ProgressBar_BusyIndicatorSize, baseRect.height());
@@ -987,11 +1209,43 @@ void Helper::renderProgressBarBusyContents(QPainter *painter, const QRect &rect,
         contentRect.translate(0, fabs(progress - 50) / 50.0 * (baseRect.height() - contentRect.height()));
     }
 
+    if (!canUsePixmapCache(painter) || contentRect.isEmpty()) {
+        drawProgressBarBusyIndicator(painter, contentRect, color, outline);
+        return;
+    }
+
+    // indicator only depends on its size and colors, the busy engine phase only moves it.
+    // The outline extends half a pixel past the indicator rect on both sides
+    QSize size(contentRect.size().toSize() + QSize(1, 1));
+
+    CacheKey key(horizontal);
+    key << color << outline << size << devicePixelRatio(painter);
+
+    QPixmap pixmap;
+    if (!_busyIndicatorCache.find(key, pixmap)) {
+        pixmap = cachePixmap(painter, size);
+
+        QPainter localPainter(&pixmap);
+        drawProgressBarBusyIndicator(&localPainter, QRectF(QPointF(), contentRect.size()), color, outline);
+        localPainter.end();
+
+        _busyIndicatorCache.insert(key, pixmap);
+    }
+
+    painter->drawPixmap(contentRect.topLeft().toPoint(), pixmap);
+}
+
+//______________________________________________________________________________
+void Helper::drawProgressBarBusyIndicator(QPainter *painter, const QRectF &rect, const QColor &color, const QColor &outline) const
+{
+    // setup painter
+    painter->setRenderHint(QPainter::Antialiasing, true);
+
+    qreal radius(0.25 * Metrics::ProgressBar_Thickness);
+
     painter->setBrush(color);
     painter->setPen(outline);
-    painter->drawRoundedRect(contentRect.translated(0.5, 0.5), radius, radius);
-
-    return;
+    painter->drawRoundedRect(rect.translated(0.5, 0.5), radius, radius);
 }
 
 //______________________________________________________________________________
@@ -1058,6 +1312,36 @@ void Helper::renderTabBarTab(QPainter *painter, const QRect &rect, const QColor
 //______________________________________________________________________________
 // TODO blurry edges
 void Helper::renderArrow(QPainter *painter, const QRect &rect, const QColor &color, ArrowOrientation orientation) const
+{
+    QPointF center(QRectF(rect).center());
+    if (!canUsePixmapCache(painter)) {
+        drawArrow(painter, center, color, orientation);
+        return;
+    }
+
+    // sprite is placed on the pixel grid, keeping the half pixel offset of odd sized rects
+    QPoint origin(qFloor(center.x()) - arrowSpriteSize / 2, qFloor(center.y()) - arrowSpriteSize / 2);
+    QPointF offset(center - QPointF(origin));
+
+    CacheKey key(orientation);
+    key << color << offset.x() << offset.y() << devicePixelRatio(painter);
+
+    QPixmap pixmap;
+    if (!_arrowCache.find(key, pixmap)) {
+        pixmap = cachePixmap(painter, QSize(arrowSpriteSize, arrowSpriteSize));
+
+        QPainter localPainter(&pixmap);
+        drawArrow(&localPainter, offset, color, orientation);
+        localPainter.end();
+
+        _arrowCache.insert(key, pixmap);
+    }
+
+    painter->drawPixmap(origin, pixmap);
+}
+
+//______________________________________________________________________________
+void Helper::drawArrow(QPainter *painter, const QPointF &center, const QColor &color, ArrowOrientation orientation) const
 {
     // define polygon
     QPolygonF arrow;
@@ -1082,15 +1366,13 @@ void Helper::renderArrow(QPainter *painter, const QRect &rect, const QColor &col
     pen.setCapStyle(Qt::FlatCap);
     pen.setJoinStyle(Qt::MiterJoin);
 
-    painter->save();
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen | PainterStateGuard::Transform);
     painter->setRenderHints(QPainter::Antialiasing);
-    painter->translate(QRectF(rect).center());
+    painter->translate(center);
     painter->setBrush(color);
     painter->setPen(pen);
     painter->drawPolygon(arrow);
 
-    painter->restore();
-
     return;
 }
 
@@ -1186,6 +1468,48 @@ QRectF Helper::shadowRect(const QRectF &rect) const
 
 //______________________________________________________________________________
 QPainterPath Helper::roundedPath(const QRectF &rect, Corners corners, qreal radius) const
+{
+    return originRoundedPath(rect.size(), corners, radius).translated(rect.topLeft());
+}
+
+//______________________________________________________________________________
+QVector<QPainterPath> Helper::roundedPaths(const QVector<QRectF> &rects, Corners corners, qreal radius) const
+{
+    QVector<QPainterPath> paths;
+    paths.reserve(rects.size());
+
+    // consecutive rects of the same size share their origin path
+    QSizeF size;
+    QPainterPath path;
+    for (auto rect = rects.constBegin(); rect != rects.constEnd(); ++rect) {
+        if (path.isEmpty() || rect->size() != size) {
+            size = rect->size();
+            path = originRoundedPath(size, corners, radius);
+        }
+
+        paths.append(path.translated(rect->topLeft()));
+    }
+
+    return paths;
+}
+
+//______________________________________________________________________________
+QPainterPath Helper::originRoundedPath(const QSizeF &size, Corners corners, qreal radius) const
+{
+    CacheKey key;
+    key << size << int(corners) << radius;
+
+    QPainterPath path;
+    if (!_roundedPathCache.find(key, path)) {
+        path = createRoundedPath(QRectF(QPointF(), size), corners, radius);
+        _roundedPathCache.insert(key, path);
+    }
+
+    return path;
+}
+
+//______________________________________________________________________________
+QPainterPath Helper::createRoundedPath(const QRectF &rect, Corners corners, qreal radius) const
 {
     QPainterPath path;
 
@@ -1261,19 +1585,102 @@ bool Helper::hasAlphaChannel(const QWidget *widget) const
 }
 
 //______________________________________________________________________________________
-QPixmap Helper::highDpiPixmap(int width, int height) const
+QPixmap Helper::highDpiPixmap(int width, int height, qreal devicePixelRatio) const
 {
-    qreal dpiRatio(qApp->devicePixelRatio());
-    QPixmap pixmap(width * dpiRatio, height * dpiRatio);
-    pixmap.setDevicePixelRatio(dpiRatio);
+    QPixmap pixmap(qCeil(width * devicePixelRatio), qCeil(height * devicePixelRatio));
+    pixmap.setDevicePixelRatio(devicePixelRatio);
     return pixmap;
 }
 
 //______________________________________________________________________________________
 qreal Helper::devicePixelRatio(const QPixmap &pixmap) const
 {
-    Q_UNUSED(pixmap);
-    return 1;
+    return pixmap.devicePixelRatio();
+}
+
+//______________________________________________________________________________________
+qreal Helper::devicePixelRatio(const QPainter *painter) const
+{
+    // follows the screen of the painted widget, or the ratio of the painted pixmap
+    return painter->device() ? painter->device()->devicePixelRatioF() : qApp->devicePixelRatio();
+}
+
+//______________________________________________________________________________________
+void Helper::invalidateCaches(void)
+{
+    _buttonFrameCache.clear();
+    _frameTileCache.clear();
+    _roundedPathCache.clear();
+    _indicatorAtlasCache.clear();
+    _arrowCache.clear();
+    _busyIndicatorCache.clear();
+    _iconPixmapCache.clear();
+}
+
+//______________________________________________________________________________________
+bool Helper::isPixelAligned(const QPainter *painter) const
+{
+    return canUsePixmapCache(painter) && devicePixelRatio(painter) == 1.0;
+}
+
+//______________________________________________________________________________________
+bool Helper::canUsePixmapCache(const QPainter *painter) const
+{
+    if (!painter->device()) {
+        return false;
+    }
+
+    // pixmaps are sized in whole device pixels. At a fractional scale they would be resampled when blitted
+    qreal dpiRatio(devicePixelRatio(painter));
+    if (dpiRatio != qRound(dpiRatio)) {
+        return false;
+    }
+
+    // only integer translations keep the blitted pixmap pixel-exact
+    const QTransform &transform(painter->transform());
+    if (transform.type() > QTransform::TxTranslate) {
+        return false;
+    }
+
+    return transform.dx() == qRound(transform.dx()) && transform.dy() == qRound(transform.dy());
+}
+
+//______________________________________________________________________________________
+bool Helper::canUseIndicatorAtlas(const QPainter *painter, const QRect &rect) const
+{
+    // atlases only hold indicators at their regular size.
+    // Sprites start on whole device pixels, since canUsePixmapCache requires an integer scale
+    return rect.width() == rect.height() && rect.width() > 0 && rect.width() <= Metrics::CheckBox_Size && canUsePixmapCache(painter);
+}
+
+//______________________________________________________________________________________
+int Helper::indicatorSlot(int state, int animatedState, qreal animation, qreal &slotAnimation) const
+{
+    // on, off and partial states come first, followed by animation frames
+    if (state != animatedState)
+        return state;
+
+    int frame(qBound(0, qRound(animation * Config::IndicatorAnimationFrames), int(Config::IndicatorAnimationFrames)));
+    slotAnimation = qreal(frame) / Config::IndicatorAnimationFrames;
+    return CheckAnimated + frame;
+}
+
+//______________________________________________________________________________________
+IndicatorAtlas *Helper::indicatorAtlas(const QPainter *painter, const CacheKey &key, const QSize &spriteSize) const
+{
+    if (IndicatorAtlas *atlas = _indicatorAtlasCache.object(key))
+        return atlas;
+
+    int slots(CheckAnimated + Config::IndicatorAnimationFrames + 1);
+    return _indicatorAtlasCache.insert(key, IndicatorAtlas(cachePixmap(painter, QSize(slots * spriteSize.width(), spriteSize.height())), spriteSize));
+}
+
+//______________________________________________________________________________________
+QPixmap Helper::cachePixmap(const QPainter *painter, const QSize &size) const
+{
+    QPixmap pixmap(highDpiPixmap(size, devicePixelRatio(painter)));
+    pixmap.fill(Qt::transparent);
+    return pixmap;
 }
 
 #if GRACEFUL_HAVE_X11
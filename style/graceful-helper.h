@@ -3,6 +3,8 @@
 
 
 #include "graceful.h"
+#include "graceful-tileset.h"
+#include "graceful-pixmap-cache.h"
 #include "animations/graceful-animation-data.h"
 //#include "config-graceful.h"
 
@@ -61,7 +63,7 @@ public:
     //* menu frame
     void renderMenuFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool roundCorners = true) const;
 
-    //* button frame
+    //* button frame. Rendered once per state and size, then blitted from cache
     void renderButtonFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, const QColor &shadow, bool focus, bool sunken, bool mouseOver, bool active, bool darkMode = false) const;
 
     //* checkbox frame
@@ -151,7 +153,7 @@ public:
         return renderProgressBarGroove(painter, rect, color, outline);
     }
 
-    //* progress bar contents (animated)
+    //* progress bar contents (animated). The moving indicator is blitted from cache
     void renderProgressBarBusyContents(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool horizontal, bool reverse, int progress) const;
 
     //* scrollbar groove
@@ -172,7 +174,7 @@ public:
     //* tabbar tab
     void renderTabBarTab(QPainter *painter, const QRect &rect, const QColor &background, const QColor &color, const QColor &outline, Corners, bool renderFrame) const;
 
-    //* generic arrow
+    //* generic arrow. Blitted from cache when painter allows it
     void renderArrow(QPainter *painter, const QRect &rect, const QColor &, ArrowOrientation) const;
 
     //* generic sign (+-)
@@ -203,24 +205,81 @@ public:
     //@name high dpi utility functions
     //@{
 
-    //* return dpi-aware pixmap of given size
-    virtual QPixmap highDpiPixmap(const QSize &size) const
+    //* return pixmap of given size, for a target with given device pixel ratio
+    virtual QPixmap highDpiPixmap(const QSize &size, qreal devicePixelRatio) const
     {
-        return highDpiPixmap(size.width(), size.height());
+        return highDpiPixmap(size.width(), size.height(), devicePixelRatio);
     }
 
-    //* return dpi-aware pixmap of given size
-    virtual QPixmap highDpiPixmap(int width) const
+    //* return square pixmap of given size, for a target with given device pixel ratio
+    virtual QPixmap highDpiPixmap(int width, qreal devicePixelRatio) const
     {
-        return highDpiPixmap(width, width);
+        return highDpiPixmap(width, width, devicePixelRatio);
     }
 
-    //* return dpi-aware pixmap of given size
-    virtual QPixmap highDpiPixmap(int width, int height) const;
+    //* return pixmap of given size, for a target with given device pixel ratio
+    virtual QPixmap highDpiPixmap(int width, int height, qreal devicePixelRatio) const;
 
     //* return device pixel ratio for a given pixmap
     virtual qreal devicePixelRatio(const QPixmap &) const;
 
+    //* return device pixel ratio of the device a painter paints on
+    virtual qreal devicePixelRatio(const QPainter *) const;
+
+    //* true if painter maps integer logical coordinates one to one onto device pixels.
+    // Axis-aligned integer geometry can then be filled directly, with the same output as antialiased drawing
+    bool isPixelAligned(const QPainter *) const;
+
+    //@}
+
+    //*@name pixmap caches
+    //@{
+
+    //* clear all cached pixmaps
+    void invalidateCaches(void);
+
+    //* button frame cache
+    const PixmapCache &buttonFrameCache(void) const
+    {
+        return _buttonFrameCache;
+    }
+
+    //* frame tileset cache
+    const Cache<TileSet> &frameTileCache(void) const
+    {
+        return _frameTileCache;
+    }
+
+    //* rounded path cache
+    const Cache<QPainterPath> &roundedPathCache(void) const
+    {
+        return _roundedPathCache;
+    }
+
+    //* checkbox and radio button atlas cache
+    const Cache<IndicatorAtlas> &indicatorAtlasCache(void) const
+    {
+        return _indicatorAtlasCache;
+    }
+
+    //* arrow cache
+    const PixmapCache &arrowCache(void) const
+    {
+        return _arrowCache;
+    }
+
+    //* busy progress bar indicator cache
+    const PixmapCache &busyIndicatorCache(void) const
+    {
+        return _busyIndicatorCache;
+    }
+
+    //* pixmaps rendered by the standard icon engines, shared by all engines
+    PixmapCache &iconPixmapCache(void) const
+    {
+        return _iconPixmapCache;
+    }
+
     //@}
 
     //*@name X11 utilities
@@ -246,6 +305,9 @@ public:
 
     void setVariant(QWidget *widget, const QByteArray &variant);
 
+    //* vertical two stop gradient, or a solid brush if both stops give the same pixel color
+    static QBrush gradientBrush(const QPointF &start, const QPointF &finalStop, const QColor &color0, const QColor &color1);
+
 protected:
     //* initialize
     void init(void);
@@ -256,7 +318,112 @@ protected:
     //* return rounded path in a given rect, with only selected corners rounded, and for a given radius
     QPainterPath roundedPath(const QRectF &, Corners, qreal) const;
 
+    //* return rounded paths for a list of rects. Geometry is built once per distinct rect size
+    QVector<QPainterPath> roundedPaths(const QVector<QRectF> &, Corners, qreal) const;
+
+    //* true if content rendered to a pixmap can be blitted with given painter without resampling.
+    // Needs an integer device pixel ratio and an integer translation
+    bool canUsePixmapCache(const QPainter *) const;
+
+    //* return transparent pixmap matching given painter device pixel ratio
+    QPixmap cachePixmap(const QPainter *, const QSize &) const;
+
 private:
+    //* true if indicator of given rect can be blitted from an atlas
+    bool canUseIndicatorAtlas(const QPainter *, const QRect &) const;
+
+    //* atlas slot for a given indicator state. Animated states are quantized to Config::IndicatorAnimationFrames
+    int indicatorSlot(int state, int animatedState, qreal animation, qreal &slotAnimation) const;
+
+    //* find cached atlas for given key, or cache an empty one. Returns nullptr if it does not fit the budget
+    IndicatorAtlas *indicatorAtlas(const QPainter *, const CacheKey &, const QSize &) const;
+
+    //* checkbox, rendered directly
+    void drawCheckBox(QPainter *painter,
+                      const QRect &rect,
+                      const QColor &background,
+                      const QColor &outline,
+                      const QColor &tickColor,
+                      bool sunken,
+                      CheckBoxState state,
+                      bool mouseOver,
+                      qreal animation,
+                      bool active,
+                      bool darkMode,
+                      bool inMenu) const;
+
+    //* radio button, rendered directly
+    void drawRadioButton(QPainter *painter,
+                         const QRect &rect,
+                         const QColor &background,
+                         const QColor &outline,
+                         const QColor &tickColor,
+                         bool sunken,
+                         bool enabled,
+                         RadioButtonState state,
+                         qreal animation,
+                         bool mouseOver,
+                         bool darkMode,
+                         bool inMenu) const;
+
+    //* busy progress bar moving indicator, rendered directly
+    void drawProgressBarBusyIndicator(QPainter *painter, const QRectF &rect, const QColor &color, const QColor &outline) const;
+
+    //* arrow centered on given point, rendered directly
+    void drawArrow(QPainter *painter, const QPointF &center, const QColor &, ArrowOrientation) const;
+
+    //* rounded path of given size, at the origin
+    QPainterPath originRoundedPath(const QSizeF &, Corners, qreal) const;
+
+    //* rounded path in a given rect, built from scratch
+    QPainterPath createRoundedPath(const QRectF &, Corners, qreal) const;
+
+    //* frames that can be composed from a tileset
+    enum FrameType {
+        GenericFrame,
+        FlatFrame,
+        TabWidgetFrame,
+    };
+
+    //* render frame from cached tileset. Returns false if frame must be rendered directly
+    bool renderFrameTileSet(QPainter *painter, const QRect &rect, FrameType, const QColor &color, const QColor &outline, bool hasFocus, Corners) const;
+
+    //* frame, rendered directly
+    void drawFrame(QPainter *painter, const QRect &rect, FrameType, const QColor &color, const QColor &outline, bool hasFocus, Corners) const;
+
+    //* generic frame, rendered directly
+    void drawGenericFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool hasFocus) const;
+
+    //* generic frame flat on right side, rendered directly
+    void drawFlatFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool hasFocus) const;
+
+    //* tab widget frame, rendered directly
+    void drawTabWidgetFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, Corners) const;
+
+    //* button frame, rendered directly
+    void drawButtonFrame(QPainter *painter, const QRect &rect, const QColor &color, const QColor &outline, bool sunken, bool mouseOver, bool active, bool darkMode) const;
+
+    //* button frame cache
+    mutable PixmapCache _buttonFrameCache;
+
+    //* frame tileset cache
+    mutable Cache<TileSet> _frameTileCache;
+
+    //* rounded path cache. Paths are stored at the origin
+    mutable Cache<QPainterPath> _roundedPathCache;
+
+    //* checkbox and radio button atlas cache
+    mutable Cache<IndicatorAtlas> _indicatorAtlasCache;
+
+    //* arrow cache
+    mutable PixmapCache _arrowCache;
+
+    //* busy progress bar indicator cache
+    mutable PixmapCache _busyIndicatorCache;
+
+    //* standard icon pixmap cache
+    mutable PixmapCache _iconPixmapCache;
+
 #if GRACEFUL_HAVE_X11
 
     //* atom used for compositing manager
@@ -0,0 +1,415 @@
+#include "graceful-icon-engine.h"
+#include "graceful-helper.h"
+
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QImage>
+#include <QDateTime>
+#include <QMutex>
+#include <QPainter>
+#include <QRunnable>
+#include <QFileInfo>
+#include <QThreadPool>
+#include <QStandardPaths>
+
+#if defined(Q_OS_LINUX)
+#include <elf.h>
+#include <link.h>
+#include <string.h>
+#endif
+
+namespace Graceful
+{
+
+#if defined(Q_OS_LINUX)
+//* dl_iterate_phdr callback, looking for the build ID note of the object that contains given address
+struct BuildIdSearch {
+    ElfW(Addr) address;
+    QByteArray id;
+};
+
+static int findBuildId(struct dl_phdr_info *info, size_t, void *data)
+{
+    BuildIdSearch *search(static_cast<BuildIdSearch *>(data));
+
+    bool found(false);
+    for (int i = 0; i < info->dlpi_phnum && !found; ++i) {
+        const ElfW(Phdr) &header(info->dlpi_phdr[i]);
+        const ElfW(Addr) start(info->dlpi_addr + header.p_vaddr);
+        found = header.p_type == PT_LOAD && search->address >= start && search->address < start + header.p_memsz;
+    }
+
+    if (!found)
+        return 0;
+
+    for (int i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr) &header(info->dlpi_phdr[i]);
+        if (header.p_type != PT_NOTE)
+            continue;
+
+        // notes are 4 byte aligned
+        const char *note(reinterpret_cast<const char *>(info->dlpi_addr + header.p_vaddr));
+        const char *end(note + header.p_memsz);
+        while (note + sizeof(ElfW(Nhdr)) <= end) {
+            const ElfW(Nhdr) *noteHeader(reinterpret_cast<const ElfW(Nhdr) *>(note));
+            const char *name(note + sizeof(ElfW(Nhdr)));
+            const char *desc(name + ((noteHeader->n_namesz + 3) & ~3u));
+            if (desc + noteHeader->n_descsz > end)
+                break;
+
+            if (noteHeader->n_type == NT_GNU_BUILD_ID && noteHeader->n_namesz == 4 && !memcmp(name, "GNU", 4)) {
+                search->id = QByteArray(desc, noteHeader->n_descsz).toHex();
+                return 1;
+            }
+
+            note = desc + ((noteHeader->n_descsz + 3) & ~3u);
+        }
+    }
+
+    return 1;
+}
+#endif
+
+//* GNU build ID of the style, as hexadecimal. Empty if it was linked without one
+static QString buildId()
+{
+#if defined(Q_OS_LINUX)
+    static const char anchor(0);
+    BuildIdSearch search = { reinterpret_cast<ElfW(Addr)>(&anchor), QByteArray() };
+    dl_iterate_phdr(findBuildId, &search);
+    return QString::fromLatin1(search.id);
+#else
+    return QString();
+#endif
+}
+
+/**
+ * standard icons persisted across runs, in one directory per Qt version and style build.
+ * Builds are told apart by their GNU build ID, so that rendering changes never serve stale icons.
+ * Without a build ID, icons are not persisted.
+ * Disk access runs in the global thread pool: persisted icons are loaded in the background
+ * when the cache is first used, and the paint path only looks them up in memory.
+ * Applications built against other versions may share the root directory and run concurrently,
+ * so that their directories are only removed once unused for Config::IconCacheMaxAge days.
+ * The directory of the current build keeps at most Config::IconCacheMaxFiles icons
+ */
+class IconDiskCache
+{
+public:
+    //* shared instance
+    static IconDiskCache &instance()
+    {
+        // never deleted, so that tasks still running at exit do not outlive it
+        static IconDiskCache *cache(new IconDiskCache);
+        return *cache;
+    }
+
+    //* true if icons are persisted
+    bool isEnabled() const
+    {
+        return !_path.isEmpty();
+    }
+
+    //* image persisted under given name. Null if not loaded (yet)
+    QImage find(const QString &name)
+    {
+        QMutexLocker locker(&_mutex);
+        return _images.value(name);
+    }
+
+    //* persist image under given name
+    void insert(const QString &name, const QImage &image)
+    {
+        {
+            QMutexLocker locker(&_mutex);
+            _images.insert(name, image);
+        }
+
+        QThreadPool::globalInstance()->start(new SaveTask(_path, name, image));
+    }
+
+private:
+    //* constructor
+    IconDiskCache()
+    {
+        if (!Config::IconCachePersistent)
+            return;
+
+        // follows $XDG_CACHE_HOME
+        QString root(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation));
+        if (root.isEmpty())
+            return;
+
+        const QString id(buildId());
+        if (id.isEmpty())
+            return;
+
+        root += QStringLiteral("/graceful/icons");
+        _path = QStringLiteral("%1/qt%2-%3").arg(root, QStringLiteral(QT_VERSION_STR), id);
+        QThreadPool::globalInstance()->start(new LoadTask(this, root));
+    }
+
+    //* name of the file marking when a directory was last used
+    static QString stampFileName()
+    {
+        return QStringLiteral(".last-used");
+    }
+
+    //* mark directory of this build as used, remove directories unused for too long, then load icons of this one
+    class LoadTask : public QRunnable
+    {
+    public:
+        LoadTask(IconDiskCache *cache, const QString &root)
+            : _cache(cache)
+            , _root(root)
+        {
+        }
+
+        virtual void run() override
+        {
+            // rewriting the stamp updates its modification time
+            QFile stamp(QStringLiteral("%1/%2").arg(_cache->_path, stampFileName()));
+            if (QDir().mkpath(_cache->_path) && stamp.open(QIODevice::WriteOnly | QIODevice::Truncate))
+                stamp.close();
+
+            const QString current(QFileInfo(_cache->_path).fileName());
+            const QDateTime limit(QDateTime::currentDateTimeUtc().addDays(-Config::IconCacheMaxAge));
+            const QFileInfoList directories(QDir(_root).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot));
+            for (auto iter = directories.constBegin(); iter != directories.constEnd(); ++iter) {
+                if (iter->fileName() == current)
+                    continue;
+
+                // icons written by a running application also count as use
+                QDateTime lastUsed(iter->lastModified().toUTC());
+                const QFileInfo stampInfo(QStringLiteral("%1/%2").arg(iter->filePath(), stampFileName()));
+                if (stampInfo.exists() && stampInfo.lastModified().toUTC() > lastUsed)
+                    lastUsed = stampInfo.lastModified().toUTC();
+
+                if (lastUsed.isValid() && lastUsed < limit)
+                    QDir(iter->filePath()).removeRecursively();
+            }
+
+            // newest first. Icons past the cap are removed, and rendered again if still used
+            QHash<QString, QImage> images;
+            const QFileInfoList files(QDir(_cache->_path).entryInfoList(QStringList() << QStringLiteral("*.png"), QDir::Files, QDir::Time));
+            for (auto iter = files.constBegin(); iter != files.constEnd(); ++iter) {
+                if (iter - files.constBegin() >= Config::IconCacheMaxFiles) {
+                    QFile::remove(iter->filePath());
+                    continue;
+                }
+
+                QImage image;
+                if (image.load(iter->filePath(), "PNG"))
+                    images.insert(iter->fileName(), image);
+            }
+
+            // icons rendered meanwhile are more recent
+            QMutexLocker locker(&_cache->_mutex);
+            for (auto iter = images.constBegin(); iter != images.constEnd(); ++iter) {
+                if (!_cache->_images.contains(iter.key()))
+                    _cache->_images.insert(iter.key(), iter.value());
+            }
+        }
+
+    private:
+        IconDiskCache *_cache;
+        QString _root;
+    };
+
+    //* write one icon
+    class SaveTask : public QRunnable
+    {
+    public:
+        SaveTask(const QString &path, const QString &name, const QImage &image)
+            : _path(path)
+            , _name(name)
+            , _image(image)
+        {
+        }
+
+        virtual void run() override
+        {
+            if (QDir().mkpath(_path))
+                _image.save(QStringLiteral("%1/%2").arg(_path, _name), "PNG");
+        }
+
+    private:
+        QString _path;
+        QString _name;
+        QImage _image;
+    };
+
+    //* directory of the current build. Empty if persistence is disabled
+    QString _path;
+
+    //* guards images
+    QMutex _mutex;
+
+    //* persisted icons, by file name
+    QHash<QString, QImage> _images;
+};
+
+//______________________________________________________________________________
+IconEngine::IconEngine(const QSharedPointer<Helper> &helper, ButtonType buttonType, const IconDataList &iconData)
+    : _helper(helper)
+    , _type(DecorationButton)
+    , _buttonType(buttonType)
+    , _orientation(ArrowNone)
+    , _fixedIconSize(0)
+    , _iconData(iconData)
+{
+}
+
+//______________________________________________________________________________
+IconEngine::IconEngine(const QSharedPointer<Helper> &helper, ArrowOrientation orientation, int fixedIconSize, const QPoint &offset, const IconDataList &iconData)
+    : _helper(helper)
+    , _type(Arrow)
+    , _buttonType(ButtonClose)
+    , _orientation(orientation)
+    , _fixedIconSize(fixedIconSize)
+    , _offset(offset)
+    , _iconData(iconData)
+{
+}
+
+//______________________________________________________________________________
+void IconEngine::paint(QPainter *painter, const QRect &rect, QIcon::Mode mode, QIcon::State state)
+{
+    // render at the painter resolution, so that nothing gets rescaled
+    qreal dpiRatio(_helper->devicePixelRatio(painter));
+    QPixmap pixmap(devicePixmap(rect.size() * dpiRatio, mode, state));
+    pixmap.setDevicePixelRatio(dpiRatio);
+    painter->drawPixmap(rect.topLeft(), pixmap);
+}
+
+//______________________________________________________________________________
+QPixmap IconEngine::pixmap(const QSize &size, QIcon::Mode mode, QIcon::State state)
+{
+    // QIcon already scales requested size by the target device pixel ratio
+    return devicePixmap(size, mode, state);
+}
+
+//______________________________________________________________________________
+QSize IconEngine::actualSize(const QSize &size, QIcon::Mode, QIcon::State)
+{
+    return size;
+}
+
+//______________________________________________________________________________
+QList<QSize> IconEngine::availableSizes(QIcon::Mode, QIcon::State) const
+{
+    // sizes the icons used to be pre-rendered at
+    return QList<QSize>() << QSize(8, 8) << QSize(16, 16) << QSize(22, 22) << QSize(32, 32) << QSize(48, 48);
+}
+
+//______________________________________________________________________________
+QString IconEngine::key() const
+{
+    return QStringLiteral("graceful");
+}
+
+//______________________________________________________________________________
+QIconEngine *IconEngine::clone() const
+{
+    return new IconEngine(*this);
+}
+
+//______________________________________________________________________________
+QPixmap IconEngine::devicePixmap(const QSize &size, QIcon::Mode mode, QIcon::State state)
+{
+    if (size.isEmpty())
+        return QPixmap();
+
+    const IconData *data(iconData(mode, state));
+    if (!data) {
+        QPixmap pixmap(size);
+        pixmap.fill(Qt::transparent);
+        return pixmap;
+    }
+
+    PixmapCache &cache(_helper->iconPixmapCache());
+    CacheKey key(cacheKey(size, *data));
+
+    QPixmap pixmap;
+    if (!cache.find(key, pixmap)) {
+        // try pixmap persisted by a previous run, render and persist otherwise
+        IconDiskCache &diskCache(IconDiskCache::instance());
+        QString fileName(diskCache.isEnabled() ? cacheFileName(size, *data) : QString());
+        QImage image(fileName.isEmpty() ? QImage() : diskCache.find(fileName));
+        if (!image.isNull() && image.size() == size) {
+            pixmap = QPixmap::fromImage(image);
+
+        } else {
+            pixmap = QPixmap(size);
+            pixmap.fill(Qt::transparent);
+            render(pixmap, *data);
+
+            if (!fileName.isEmpty())
+                diskCache.insert(fileName, pixmap.toImage());
+        }
+
+        cache.insert(key, pixmap);
+    }
+
+    return pixmap;
+}
+
+//______________________________________________________________________________
+void IconEngine::render(QPixmap &pixmap, const IconData &data) const
+{
+    QPainter painter(&pixmap);
+    switch (_type) {
+    case DecorationButton:
+        _helper->renderDecorationButton(&painter, pixmap.rect(), data._color, _buttonType, data._inverted);
+        break;
+    case Arrow: {
+        QRect fixedRect(0, 0, _fixedIconSize, _fixedIconSize);
+        painter.setWindow(fixedRect);
+        painter.translate(_offset);
+        _helper->renderArrow(&painter, fixedRect, data._color, _orientation);
+        break;
+    }
+    }
+}
+
+//______________________________________________________________________________
+CacheKey IconEngine::cacheKey(const QSize &size, const IconData &data) const
+{
+    CacheKey key(_type);
+    if (_type == DecorationButton)
+        key << int(_buttonType);
+    else
+        key << int(_orientation) << _fixedIconSize << _offset.x() << _offset.y();
+
+    key << data._color << data._inverted << size;
+    return key;
+}
+
+//______________________________________________________________________________
+QString IconEngine::cacheFileName(const QSize &size, const IconData &data) const
+{
+    QString type(_type == DecorationButton ?
+                 QStringLiteral("button%1").arg(int(_buttonType)) :
+                 QStringLiteral("arrow%1_%2_%3_%4").arg(int(_orientation)).arg(_fixedIconSize).arg(_offset.x()).arg(_offset.y()));
+
+    return QStringLiteral("%1-%2-%3-%4x%5.png")
+           .arg(type)
+           .arg(data._color.rgba(), 8, 16, QLatin1Char('0'))
+           .arg(data._inverted ? 1 : 0)
+           .arg(size.width())
+           .arg(size.height());
+}
+
+//______________________________________________________________________________
+const IconEngine::IconData *IconEngine::iconData(QIcon::Mode mode, QIcon::State state) const
+{
+    for (auto iter = _iconData.constBegin(); iter != _iconData.constEnd(); ++iter) {
+        if (iter->_mode == mode && iter->_state == state)
+            return &(*iter);
+    }
+
+    return nullptr;
+}
+
+} // namespace Graceful
@@ -0,0 +1,96 @@
+#ifndef GRACEFUL_ICON_ENGINE_H
+#define GRACEFUL_ICON_ENGINE_H
+
+#include "graceful.h"
+#include "graceful-pixmap-cache.h"
+
+#include <QHash>
+#include <QIcon>
+#include <QList>
+#include <QIconEngine>
+#include <QSharedPointer>
+
+namespace Graceful
+{
+class Helper;
+
+//* renders style standard icons on demand, at the exact size and device pixel ratio requested.
+//* Rendered pixmaps are kept in Helper::iconPixmapCache, within the pixmap budget
+class IconEngine : public QIconEngine
+{
+public:
+    //* color and inversion flag used for a given icon mode and state
+    struct IconData {
+        QColor _color;
+        bool _inverted;
+        QIcon::Mode _mode;
+        QIcon::State _state;
+    };
+
+    using IconDataList = QList<IconData>;
+
+    //* title bar button icon, rendered with Helper::renderDecorationButton
+    explicit IconEngine(const QSharedPointer<Helper> &helper, ButtonType buttonType, const IconDataList &iconData);
+
+    //* arrow icon, rendered with Helper::renderArrow in a fixed window of given size, then offset
+    explicit IconEngine(const QSharedPointer<Helper> &helper, ArrowOrientation orientation, int fixedIconSize, const QPoint &offset, const IconDataList &iconData);
+
+    //*@name QIconEngine interface
+    //@{
+
+    virtual void paint(QPainter *painter, const QRect &rect, QIcon::Mode mode, QIcon::State state) override;
+    virtual QPixmap pixmap(const QSize &size, QIcon::Mode mode, QIcon::State state) override;
+    virtual QSize actualSize(const QSize &size, QIcon::Mode mode, QIcon::State state) override;
+    virtual QList<QSize> availableSizes(QIcon::Mode mode, QIcon::State state) const override;
+    virtual QString key() const override;
+    virtual QIconEngine *clone() const override;
+
+    //@}
+
+private:
+    //* icon type
+    enum Type {
+        DecorationButton,
+        Arrow
+    };
+
+    //* pixmap of given size in device pixels, rendered on first request
+    QPixmap devicePixmap(const QSize &size, QIcon::Mode mode, QIcon::State state);
+
+    //* render icon in given pixmap
+    void render(QPixmap &pixmap, const IconData &data) const;
+
+    //* key of a rendered pixmap in Helper::iconPixmapCache. Engines rendering the same icon share it
+    CacheKey cacheKey(const QSize &size, const IconData &data) const;
+
+    //* name of the file used to persist a rendered pixmap
+    QString cacheFileName(const QSize &size, const IconData &data) const;
+
+    //* icon data matching mode and state
+    const IconData *iconData(QIcon::Mode mode, QIcon::State state) const;
+
+    //* helper
+    QSharedPointer<Helper> _helper;
+
+    //* type
+    Type _type;
+
+    //* decoration button type
+    ButtonType _buttonType;
+
+    //* arrow orientation
+    ArrowOrientation _orientation;
+
+    //* arrow window size
+    int _fixedIconSize;
+
+    //* arrow offset
+    QPoint _offset;
+
+    //* colors
+    IconDataList _iconData;
+};
+
+} // namespace Graceful
+
+#endif // GRACEFUL_ICON_ENGINE_H
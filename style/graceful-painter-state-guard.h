@@ -0,0 +1,95 @@
+#ifndef GRACEFUL_PAINTER_STATE_GUARD_H
+#define GRACEFUL_PAINTER_STATE_GUARD_H
+
+#include <QPen>
+#include <QFlags>
+#include <QBrush>
+#include <QPainter>
+#include <QTransform>
+
+namespace Graceful
+{
+/**
+ * restores selected painter state when going out of scope.
+ * Lighter than QPainter::save and restore, which copy the full painter state, including clipping and font.
+ * Code that changes anything else must still use save and restore
+ */
+class PainterStateGuard
+{
+public:
+    //* state to restore
+    enum StateFlag {
+        None = 0,
+        Pen = 0x1,
+        Brush = 0x2,
+        RenderHints = 0x4,
+        Transform = 0x8
+    };
+    Q_DECLARE_FLAGS(State, StateFlag)
+
+    //* constructor. Records given state
+    explicit PainterStateGuard(QPainter *painter, State state)
+        : _painter(painter)
+        , _state(state)
+    {
+        if (_state & Pen) {
+            _pen = _painter->pen();
+        }
+
+        if (_state & Brush) {
+            _brush = _painter->brush();
+        }
+
+        if (_state & RenderHints) {
+            _renderHints = _painter->renderHints();
+        }
+
+        if (_state & Transform) {
+            _transform = _painter->transform();
+        }
+    }
+
+    //* destructor. Restores recorded state
+    ~PainterStateGuard()
+    {
+        if (_state & Pen) {
+            _painter->setPen(_pen);
+        }
+
+        if (_state & Brush) {
+            _painter->setBrush(_brush);
+        }
+
+        if (_state & RenderHints) {
+            const QPainter::RenderHints current(_painter->renderHints());
+            if (current != _renderHints) {
+                _painter->setRenderHints(current & ~_renderHints, false);
+                _painter->setRenderHints(_renderHints, true);
+            }
+        }
+
+        if (_state & Transform) {
+            _painter->setTransform(_transform);
+        }
+    }
+
+private:
+    Q_DISABLE_COPY(PainterStateGuard)
+
+    //* painter
+    QPainter *_painter;
+
+    //* recorded state
+    State _state;
+
+    QPen _pen;
+    QBrush _brush;
+    QPainter::RenderHints _renderHints;
+    QTransform _transform;
+};
+
+} // namespace Graceful
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(Graceful::PainterStateGuard::State)
+
+#endif // GRACEFUL_PAINTER_STATE_GUARD_H
@@ -0,0 +1,342 @@
+#ifndef GRACEFUL_PIXMAP_CACHE_H
+#define GRACEFUL_PIXMAP_CACHE_H
+#include "graceful-pixmap-budget.h"
+
+#include <QRect>
+#include <QSize>
+#include <QHash>
+#include <QIcon>
+#include <QColor>
+#include <QPixmap>
+#include <QPainterPath>
+#include <QVarLengthArray>
+
+#include <algorithm>
+
+namespace Graceful
+{
+//* compact cache key, built from the values a rendered result depends on
+class CacheKey
+{
+public:
+    //* constructor
+    explicit CacheKey(quint32 tag = 0)
+    {
+        _words.append(tag);
+    }
+
+    //*@name accumulators
+    //@{
+
+    CacheKey &operator<<(quint32 value)
+    {
+        _words.append(value);
+        return *this;
+    }
+
+    CacheKey &operator<<(int value)
+    {
+        return *this << quint32(value);
+    }
+
+    CacheKey &operator<<(bool value)
+    {
+        return *this << quint32(value ? 1 : 0);
+    }
+
+    CacheKey &operator<<(qint64 value)
+    {
+        return *this << quint32(quint64(value) >> 32) << quint32(quint64(value) & 0xffffffff);
+    }
+
+    //* device pixel ratio and other fractional values, kept to 1/1000th
+    CacheKey &operator<<(qreal value)
+    {
+        return *this << quint32(qRound(value * 1000));
+    }
+
+    CacheKey &operator<<(const QSize &size)
+    {
+        return *this << size.width() << size.height();
+    }
+
+    CacheKey &operator<<(const QSizeF &size)
+    {
+        return *this << size.width() << size.height();
+    }
+
+    //* invalid colors must not collide with opaque black
+    CacheKey &operator<<(const QColor &color)
+    {
+        return *this << color.isValid() << quint32(color.isValid() ? color.rgba() : 0);
+    }
+
+    //@}
+
+    //* equal to operator
+    bool operator==(const CacheKey &other) const
+    {
+        return _words.size() == other._words.size() && std::equal(_words.constBegin(), _words.constEnd(), other._words.constBegin());
+    }
+
+    //* hash
+    uint hash() const
+    {
+        return qHashBits(_words.constData(), _words.size() * sizeof(quint32));
+    }
+
+private:
+    //* key content
+    QVarLengthArray<quint32, 16> _words;
+};
+
+//* hash
+inline uint qHash(const CacheKey &key)
+{
+    return key.hash();
+}
+
+//* cost of a cached pixmap, in bytes
+inline qint64 cacheCost(const QPixmap &pixmap)
+{
+    return qint64(pixmap.width()) * pixmap.height() * 4;
+}
+
+//* sprites of same size laid out in a single row, rendered on demand
+class IndicatorAtlas
+{
+public:
+    //* empty atlas
+    IndicatorAtlas() : _rendered(0)
+    {
+    }
+
+    //* atlas backed by given transparent pixmap
+    explicit IndicatorAtlas(const QPixmap &pixmap, const QSize &spriteSize) : _pixmap(pixmap), _spriteSize(spriteSize), _rendered(0)
+    {
+    }
+
+    //* pixmap
+    QPixmap &pixmap()
+    {
+        return _pixmap;
+    }
+
+    const QPixmap &pixmap() const
+    {
+        return _pixmap;
+    }
+
+    //* logical rect of a given slot
+    QRect spriteRect(int slot) const
+    {
+        return QRect(QPoint(slot * _spriteSize.width(), 0), _spriteSize);
+    }
+
+    //* true if slot has been rendered
+    bool isRendered(int slot) const
+    {
+        return _rendered & (quint64(1) << slot);
+    }
+
+    //* mark slot as rendered
+    void setRendered(int slot)
+    {
+        _rendered |= (quint64(1) << slot);
+    }
+
+private:
+    //* pixmap
+    QPixmap _pixmap;
+
+    //* sprite size
+    QSize _spriteSize;
+
+    //* rendered slots
+    quint64 _rendered;
+};
+
+//* cost of a cached atlas, in bytes
+inline qint64 cacheCost(const IndicatorAtlas &atlas)
+{
+    return cacheCost(atlas.pixmap());
+}
+
+//* cost of a cached path, in bytes
+inline qint64 cacheCost(const QPainterPath &path)
+{
+    return 64 + qint64(path.elementCount()) * sizeof(QPainterPath::Element);
+}
+
+/**
+ * bounded LRU cache of implicitly shared values.
+ * Caches register with PixmapBudget, which enforces their quota as well as a global cap.
+ * Lookups only restamp the entry; entries are ordered by stamp when evicting
+ */
+template<typename T> class Cache : public PixmapBudget::Client
+{
+public:
+    //* constructor. Quota is expressed in kilobytes
+    explicit Cache(const QString &name, int maxCost) : _bytes(0), _hits(0), _misses(0)
+    {
+        PixmapBudget::instance().registerCache(this, name, qint64(maxCost) * 1024);
+    }
+
+    //* destructor
+    virtual ~Cache()
+    {
+        PixmapBudget::instance().unregisterCache(this);
+    }
+
+    //* find value matching key. Returns false on cache miss
+    bool find(const CacheKey &key, T &value)
+    {
+        auto iter(_entries.find(key));
+        if (iter == _entries.end()) {
+            ++_misses;
+            return false;
+        }
+
+        // mark as most recently used
+        ++_hits;
+        iter->stamp = PixmapBudget::instance().nextStamp();
+
+        value = iter->value;
+        return true;
+    }
+
+    /**
+     * value matching key, to be modified in place without detaching it. Returns nullptr on cache miss.
+     * The pointer is only valid until the next insertion in any cache, which may evict it.
+     * Modifications must not change the value cost
+     */
+    T *object(const CacheKey &key)
+    {
+        auto iter(_entries.find(key));
+        if (iter == _entries.end()) {
+            ++_misses;
+            return nullptr;
+        }
+
+        // mark as most recently used
+        ++_hits;
+        iter->stamp = PixmapBudget::instance().nextStamp();
+        return &iter->value;
+    }
+
+    //* insert value, evicting least recently used entries if over budget. Returns the cached value, or nullptr if it did not fit
+    T *insert(const CacheKey &key, const T &value)
+    {
+        remove(key);
+
+        Entry entry = { value, cacheCost(value), PixmapBudget::instance().nextStamp() };
+        _entries.insert(key, entry);
+        _bytes += entry.cost;
+
+        PixmapBudget::instance().enforce(this);
+
+        auto iter(_entries.find(key));
+        return iter == _entries.end() ? nullptr : &iter->value;
+    }
+
+    //* remove value matching key
+    void remove(const CacheKey &key)
+    {
+        auto iter(_entries.find(key));
+        if (iter == _entries.end())
+            return;
+
+        _bytes -= iter->cost;
+        _entries.erase(iter);
+    }
+
+    //* number of entries
+    int count() const
+    {
+        return _entries.size();
+    }
+
+    //*@name budget client interface
+    //@{
+
+    virtual qint64 bytes() const override
+    {
+        return _bytes;
+    }
+
+    virtual quint64 oldestStamp() const override
+    {
+        auto iter(oldest());
+        return iter == _entries.constEnd() ? 0 : iter->stamp;
+    }
+
+    virtual void evictOldest() override
+    {
+        auto iter(oldest());
+        if (iter == _entries.constEnd())
+            return;
+
+        const CacheKey key(iter.key());
+        remove(key);
+    }
+
+    virtual void clear() override
+    {
+        _entries.clear();
+        _bytes = 0;
+    }
+
+    virtual int hits() const override
+    {
+        return _hits;
+    }
+
+    virtual int misses() const override
+    {
+        return _misses;
+    }
+
+    //@}
+
+private:
+    Q_DISABLE_COPY(Cache)
+
+    //* cached value
+    struct Entry {
+        T value;
+        qint64 cost;
+        quint64 stamp;
+    };
+
+    //* entries
+    typedef QHash<CacheKey, Entry> Entries;
+    Entries _entries;
+
+    //* least recently used entry, end if empty
+    typename Entries::const_iterator oldest() const
+    {
+        auto out(_entries.constEnd());
+        for (auto iter = _entries.constBegin(); iter != _entries.constEnd(); ++iter) {
+            if (out == _entries.constEnd() || iter->stamp < out->stamp)
+                out = iter;
+        }
+
+        return out;
+    }
+
+    //* bytes used
+    qint64 _bytes;
+
+    //* hit counter
+    int _hits;
+
+    //* miss counter
+    int _misses;
+};
+
+//* pixmap cache
+typedef Cache<QPixmap> PixmapCache;
+
+} // namespace Graceful
+
+#endif // GRACEFUL_PIXMAP_CACHE_H
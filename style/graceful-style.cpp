@@ -5,6 +5,7 @@
 #include "graceful.h"
 #include "graceful-colors.h"
 #include "graceful-mnemonics.h"
+#include "graceful-painter-state-guard.h"
 #include "graceful-splitter-proxy.h"
 #include "graceful-window-manager.h"
 #include "graceful-widget-explorer.h"
@@ -211,6 +212,8 @@ Style::Style(bool dark)
     , _splitterFactory(new SplitterFactory(this))
     , _widgetExplorer(new WidgetExplorer(this))
     , _tabBarData(new GracefulPrivate::TabBarData(this))
+    , _iconCache(Config::IconCacheSize)
+    , _disabledPaletteCache(Config::DisabledPaletteCacheSize)
     , _dark(dark)
 {
 
@@ -242,8 +245,6 @@ Style::Style(bool dark)
 //______________________________________________________________
 Style::~Style(void)
 {
-
-    delete _helper;
 }
 
 void Style::polish(QWidget *widget)
@@ -1388,16 +1389,26 @@ void Style::drawItemText(QPainter *painter, const QRect &rect, int flags, const
         flags |= Qt::AlignVCenter;
     }
 
-    if (_animations->widgetEnabilityEngine().enabled()) {
+    if (_animations->widgetStateEngine().enabled()) {
         /*
          * check if painter engine is registered to WidgetEnabilityEngine, and animated
          * if yes, merge the palettes. Note: a static_cast is safe here, since only the address
          * of the pointer is used, not the actual content.
          */
         const QWidget *widget(static_cast<const QWidget *>(painter->device()));
-        if (_animations->widgetEnabilityEngine().isAnimated(widget, AnimationEnable)) {
-            QPalette copy(Colors::disabledPalette(palette, _animations->widgetEnabilityEngine().opacity(widget, AnimationEnable)));
-            return ParentStyleClass::drawItemText(painter, rect, flags, copy, enabled, text, textRole);
+        if (_animations->widgetStateEngine().isAnimated(widget, AnimationEnable)) {
+            // ratio is digitized, so that all text drawn at the same step shares one palette
+            const qreal ratio(_animations->widgetStateEngine().opacity(widget, AnimationEnable));
+            CacheKey key;
+            key << palette.cacheKey() << ratio;
+
+            QPalette *copy(_disabledPaletteCache.object(key));
+            if (!copy) {
+                copy = new QPalette(Colors::disabledPalette(palette, ratio));
+                _disabledPaletteCache.insert(key, copy);
+            }
+
+            return ParentStyleClass::drawItemText(painter, rect, flags, *copy, enabled, text, textRole);
         }
     }
 
@@ -1476,7 +1487,7 @@ bool Style::eventFilterScrollArea(QWidget *widget, QEvent *event)
         const QPalette::ColorRole role(viewport->backgroundRole());
         QColor background;
         if (role == QPalette::Window && hasAlteredBackground(viewport)) {
-            background = Colors::frameBackgroundColor(StyleOptions(viewport->palette()));
+            background = Colors::frameBackgroundColor(PaintOptions(viewport->palette()));
         } else {
             background = viewport->palette().color(role);
         }
@@ -1563,8 +1574,8 @@ bool Style::eventFilterComboBoxContainer(QWidget *widget, QEvent *event)
 
         QRect rect(widget->rect());
         const QPalette &palette(widget->palette());
-        QColor background(Colors::frameBackgroundColor(StyleOptions(palette)));
-        QColor outline(Colors::frameOutlineColor(StyleOptions(palette)));
+        QColor background(Colors::frameBackgroundColor(PaintOptions(palette)));
+        QColor outline(Colors::frameOutlineColor(PaintOptions(palette)));
 
         bool hasAlpha(_helper->hasAlphaChannel(widget));
         if (hasAlpha) {
@@ -1590,8 +1601,8 @@ bool Style::eventFilterDockWidget(QDockWidget *dockWidget, QEvent *event)
 
         // store palette and set colors
         const QPalette &palette(dockWidget->palette());
-        QColor background(Colors::frameBackgroundColor(StyleOptions(palette)));
-        QColor outline(Colors::frameOutlineColor(StyleOptions(palette)));
+        QColor background(Colors::frameBackgroundColor(PaintOptions(palette)));
+        QColor outline(Colors::frameOutlineColor(PaintOptions(palette)));
 
         // store rect
         QRect rect(dockWidget->rect());
@@ -1734,12 +1745,27 @@ void Style::configurationChanged(void)
 
 QIcon Style::standardIconImplementation(StandardPixmap standardPixmap, const QStyleOption *option, const QWidget *widget) const
 {
+    // icons depend on the palette they are generated with
+    // due to Qt, it is not always safe to assume that either option, nor widget are defined
+    QPalette palette;
+    if (option) {
+        palette = option->palette;
+    } else if (widget) {
+        palette = widget->palette();
+    } else {
+        palette = QApplication::palette();
+    }
+
+    CacheKey key(standardPixmap);
+    key << palette.cacheKey() << _dark;
+
     // lookup cache
-    if (_iconCache.contains(standardPixmap)) {
-        return _iconCache.value(standardPixmap);
+    if (const QIcon *cached = _iconCache.object(key)) {
+        return *cached;
     }
 
     QIcon icon;
+
     switch (standardPixmap) {
     case SP_TitleBarNormalButton:
     case SP_TitleBarMinButton:
@@ -1762,7 +1788,7 @@ QIcon Style::standardIconImplementation(StandardPixmap standardPixmap, const QSt
     if (icon.isNull()) {
         return  ParentStyleClass::standardIcon(standardPixmap, option, widget);
     } else {
-        const_cast<IconCache *>(&_iconCache)->insert(standardPixmap, icon);
+        _iconCache.insert(key, new QIcon(icon));
         return icon;
     }
 }
@@ -1784,8 +1810,12 @@ void Style::loadConfiguration()
     // splitter proxy
     _splitterFactory->setEnabled(Graceful::Config::SplitterProxyEnabled);
 
-    // clear icon cache
+    // clear icon and palette caches
     _iconCache.clear();
+    _disabledPaletteCache.clear();
+
+    // clear rendered pixmaps
+    _helper->invalidateCaches();
 
     // scrollbar buttons
     switch (Graceful::Config::ScrollBarAddLineButtons) {
@@ -3445,7 +3475,7 @@ bool Style::drawFramePrimitive(const QStyleOption *option, QPainter *painter, co
     qreal opacity(_animations->inputWidgetEngine().frameOpacity(widget));
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setHasFocus(hasFocus);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setOpacity(opacity);
@@ -3500,7 +3530,7 @@ bool Style::drawFrameLineEditPrimitive(const QStyleOption *option, QPainter *pai
         qreal opacity(_animations->inputWidgetEngine().frameOpacity(widget));
 
         // Style options
-        StyleOptions styleOptions(palette);
+        PaintOptions styleOptions(palette);
         styleOptions.setMouseOver(mouseOver);
         styleOptions.setHasFocus(hasFocus);
         styleOptions.setOpacity(opacity);
@@ -3555,15 +3585,15 @@ bool Style::drawFrameMenuPrimitive(const QStyleOption *option, QPainter *painter
     // do nothing for other cases, for which frame is rendered via drawPanelMenuPrimitive
     if (qobject_cast<const QToolBar *>(widget)) {
         const QPalette &palette(option->palette);
-        QColor background(Colors::frameBackgroundColor(StyleOptions(palette)));
-        QColor outline(Colors::frameOutlineColor(StyleOptions(palette)));
+        QColor background(Colors::frameBackgroundColor(PaintOptions(palette)));
+        QColor outline(Colors::frameOutlineColor(PaintOptions(palette)));
 
         bool hasAlpha(_helper->hasAlphaChannel(widget));
         _helper->renderMenuFrame(painter, option->rect, background, outline, hasAlpha);
     } else if (isQtQuickControl(option, widget)) {
         const QPalette &palette(option->palette);
-        QColor background(Colors::frameBackgroundColor(StyleOptions(palette)));
-        QColor outline(Colors::frameOutlineColor(StyleOptions(palette)));
+        QColor background(Colors::frameBackgroundColor(PaintOptions(palette)));
+        QColor outline(Colors::frameOutlineColor(PaintOptions(palette)));
 
         bool hasAlpha(_helper->hasAlphaChannel(widget));
         _helper->renderMenuFrame(painter, option->rect, background, outline, hasAlpha);
@@ -3671,7 +3701,7 @@ bool Style::drawFrameTabWidgetPrimitive(const QStyleOption *option, QPainter *pa
     // define colors
     const QPalette &palette(option->palette);
     QColor background(palette.color(QPalette::Base));
-    QColor outline(Colors::frameOutlineColor(StyleOptions(palette)));
+    QColor outline(Colors::frameOutlineColor(PaintOptions(palette)));
     _helper->renderTabWidgetFrame(painter, rect, background, outline, corners);
 
     return true;
@@ -3690,7 +3720,7 @@ bool Style::drawFrameTabBarBasePrimitive(const QStyleOption *option, QPainter *p
     }
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setState(option->state);
 
     // get rect, orientation, palette
@@ -3719,7 +3749,7 @@ bool Style::drawFrameWindowPrimitive(const QStyleOption *option, QPainter *paint
     bool selected(state & State_Selected);
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setMouseOver(false);
     styleOptions.setHasFocus(selected);
 
@@ -3769,7 +3799,7 @@ bool Style::drawIndicatorArrowPrimitive(ArrowOrientation orientation, const QSty
     bool inToolButton(qstyleoption_cast<const QStyleOptionToolButton *>(option));
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(hasFocus);
 
@@ -3800,10 +3830,10 @@ bool Style::drawIndicatorArrowPrimitive(ArrowOrientation orientation, const QSty
             // for menu arrows in flat toolbutton one uses animations to get the arrow color
             // handle arrow over animation
             bool arrowHover(mouseOver && (toolButtonOption->activeSubControls & SC_ToolButtonMenu));
-            _animations->toolButtonEngine().updateState(widget, AnimationHover, arrowHover);
+            _animations->widgetStateEngine().updateState(widget, AnimationSubControlHover, arrowHover);
 
-            bool animated(_animations->toolButtonEngine().isAnimated(widget, AnimationHover));
-            qreal opacity(_animations->toolButtonEngine().opacity(widget, AnimationHover));
+            bool animated(_animations->widgetStateEngine().isAnimated(widget, AnimationSubControlHover));
+            qreal opacity(_animations->widgetStateEngine().opacity(widget, AnimationSubControlHover));
 
             // Style ooptions
             styleOptions.setAnimationMode(animated ? AnimationHover : AnimationNone);
@@ -3866,7 +3896,7 @@ bool Style::drawIndicatorHeaderArrowPrimitive(const QStyleOption *option, QPaint
     }
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setState(state);
 
     // define color and polygon for drawing arrow
@@ -3908,7 +3938,7 @@ bool Style::drawPanelButtonCommandPrimitive(const QStyleOption *option, QPainter
     qreal opacity(_animations->widgetStateEngine().buttonOpacity(widget));
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(hasFocus);
     styleOptions.setSunken(sunken);
@@ -3965,7 +3995,7 @@ bool Style::drawPanelButtonToolPrimitive(const QStyleOption *option, QPainter *p
     qreal opacity(_animations->widgetStateEngine().buttonOpacity(widget));
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(hasFocus);
     styleOptions.setSunken(sunken);
@@ -4045,7 +4075,7 @@ bool Style::drawTabBarPanelButtonToolPrimitive(const QStyleOption *option, QPain
     }
     QPalette palette(parent ? parent->palette() : QApplication::palette());
 
-    QColor color = hasAlteredBackground(parent) ? Colors::frameBackgroundColor(StyleOptions(palette)) : palette.color(QPalette::Window);
+    QColor color = hasAlteredBackground(parent) ? Colors::frameBackgroundColor(PaintOptions(palette)) : palette.color(QPalette::Window);
 
     // render flat background
     painter->setPen(Qt::NoPen);
@@ -4087,8 +4117,8 @@ bool Style::drawPanelMenuPrimitive(const QStyleOption *option, QPainter *painter
     }
 
     const QPalette &palette(option->palette);
-    QColor background(Colors::frameBackgroundColor(StyleOptions(palette)));
-    QColor outline(Colors::frameOutlineColor(StyleOptions(palette)));
+    QColor background(Colors::frameBackgroundColor(PaintOptions(palette)));
+    QColor outline(Colors::frameOutlineColor(PaintOptions(palette)));
 
     bool hasAlpha(_helper->hasAlphaChannel(widget));
     _helper->renderMenuFrame(painter, option->rect, background, outline, hasAlpha);
@@ -4228,7 +4258,7 @@ bool Style::drawIndicatorCheckBoxPrimitive(const QStyleOption *option, QPainter
     }
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(false);
     styleOptions.setSunken(sunken);
@@ -4273,7 +4303,7 @@ bool Style::drawIndicatorCheckBoxPrimitive(const QStyleOption *option, QPainter
     }
 
     // render
-    QColor shadow(Colors::shadowColor(StyleOptions(palette)));
+    QColor shadow(Colors::shadowColor(PaintOptions(palette)));
     _helper->renderCheckBox(painter, rect, background, outline, tickColor, sunken, checkBoxState, mouseOver, animation, enabled && windowActive, _dark);
     return true;
 }
@@ -4295,7 +4325,7 @@ bool Style::drawIndicatorRadioButtonPrimitive(const QStyleOption *option, QPaint
     bool windowActive(state & State_Active);
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(false);
     styleOptions.setSunken(sunken);
@@ -4322,7 +4352,7 @@ bool Style::drawIndicatorRadioButtonPrimitive(const QStyleOption *option, QPaint
     qreal animation(_animations->widgetStateEngine().opacity(widget, AnimationPressed));
 
     // colors
-    QColor shadow(Colors::shadowColor(StyleOptions(palette)));
+    QColor shadow(Colors::shadowColor(PaintOptions(palette)));
     QColor tickColor;
     if (isSelectedItem) {
         // Style options
@@ -4385,7 +4415,7 @@ bool Style::drawIndicatorButtonDropDownPrimitive(const QStyleOption *option, QPa
     qreal opacity(_animations->widgetStateEngine().buttonOpacity(widget));
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(false);
     styleOptions.setSunken(sunken);
@@ -4394,7 +4424,7 @@ bool Style::drawIndicatorButtonDropDownPrimitive(const QStyleOption *option, QPa
     styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
     // render as push button
-    QColor shadow(Colors::shadowColor(StyleOptions(palette)));
+    QColor shadow(Colors::shadowColor(PaintOptions(palette)));
     QColor outline(Colors::buttonOutlineColor(styleOptions));
     QColor background(Colors::buttonBackgroundColor(styleOptions));
 
@@ -4534,7 +4564,7 @@ bool Style::drawIndicatorToolBarHandlePrimitive(const QStyleOption *option, QPai
     bool separatorIsVertical(state & State_Horizontal);
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
     // define color and render
@@ -4582,7 +4612,7 @@ bool Style::drawIndicatorToolBarSeparatorPrimitive(const QStyleOption *option, Q
     bool separatorIsVertical(state & State_Horizontal);
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
     // define color and render
@@ -4629,11 +4659,11 @@ bool Style::drawIndicatorBranchPrimitive(const QStyleOption *option, QPainter *p
         }
 
         // Style options
-        StyleOptions styleOptions(option->palette);
+        PaintOptions styleOptions(option->palette);
         styleOptions.setColorRole(QPalette::Text);
 
         // color
-        QColor arrowColor(mouseOver ? Colors::hoverColor(StyleOptions(palette)) : Colors::arrowOutlineColor(styleOptions));
+        QColor arrowColor(mouseOver ? Colors::hoverColor(PaintOptions(palette)) : Colors::arrowOutlineColor(styleOptions));
 
         // render
         _helper->renderArrow(painter, arrowRect, arrowColor, orientation);
@@ -4646,7 +4676,28 @@ bool Style::drawIndicatorBranchPrimitive(const QStyleOption *option, QPainter *p
 
     QPoint center(rect.center());
     QColor lineColor(Colors::mix(palette.color(QPalette::Base), palette.color(QPalette::Text), 0.25));
-    painter->save();
+
+    // lines are one pixel wide and centered on pixels, fill them directly when possible
+    if (_helper->isPixelAligned(painter)) {
+        if (state & (State_Item | State_Children | State_Sibling)) {
+            painter->fillRect(QRect(QPoint(center.x(), rect.top()), QPoint(center.x(), center.y() - expanderAdjust - 1)).normalized(), lineColor);
+        }
+
+        if (state & State_Item) {
+            const QRect line = reverseLayout ?
+                               QRect(QPoint(rect.left(), center.y()), QPoint(center.x() - expanderAdjust, center.y())) :
+                               QRect(QPoint(center.x() + expanderAdjust, center.y()), QPoint(rect.right(), center.y()));
+            painter->fillRect(line.normalized(), lineColor);
+        }
+
+        if (state & State_Sibling) {
+            painter->fillRect(QRect(QPoint(center.x(), center.y() + expanderAdjust), QPoint(center.x(), rect.bottom())).normalized(), lineColor);
+        }
+
+        return true;
+    }
+
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Pen | PainterStateGuard::Transform);
     painter->setRenderHint(QPainter::Antialiasing, true);
     painter->translate(0.5, 0.5);
     painter->setPen(QPen(lineColor, 1));
@@ -4668,7 +4719,6 @@ bool Style::drawIndicatorBranchPrimitive(const QStyleOption *option, QPainter *p
         QLineF line(QPointF(center.x(), center.y() + expanderAdjust), QPointF(center.x(), rect.bottom()));
         painter->drawLine(line);
     }
-    painter->restore();
 
     return true;
 }
@@ -4733,7 +4783,7 @@ bool Style::drawPushButtonLabelControl(const QStyleOption *option, QPainter *pai
         arrowRect = visualRect(option, arrowRect);
 
         // Style options
-        StyleOptions styleOptions(option->palette);
+        PaintOptions styleOptions(option->palette);
         styleOptions.setColorRole(textRole);
 
         // define color
@@ -5023,7 +5073,7 @@ bool Style::drawComboBoxLabelControl(const QStyleOption *option, QPainter *paint
     QPalette::ColorRole textRole = QPalette::ButtonText;
 
     // change pen color directly
-    painter->save();
+    PainterStateGuard guard(painter, PainterStateGuard::Pen);
     painter->setPen(QPen(option->palette.color(textRole), 1));
 
     if (const QStyleOptionComboBox *cb = qstyleoption_cast<const QStyleOptionComboBox *>(option)) {
@@ -5066,8 +5116,6 @@ bool Style::drawComboBoxLabelControl(const QStyleOption *option, QPainter *paint
         painter->restore();
     }
 
-    painter->restore();
-
     return true;
 }
 
@@ -5104,13 +5152,12 @@ bool Style::drawMenuBarEmptyArea(const QStyleOption *option, QPainter *painter,
     const QRect &rect(option->rect);
     const QPalette &palette(option->palette);
 
-    painter->save();
+    PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen);
     painter->setRenderHint(QPainter::Antialiasing, false);
     painter->setBrush(Qt::NoBrush);
     painter->setPen(Colors::mix(palette.color(QPalette::Window), palette.color(QPalette::Shadow), 0.2));
 
     painter->drawLine(rect.bottomLeft(), rect.bottomRight());
-    painter->restore();
 
     return true;
 }
@@ -5134,22 +5181,23 @@ bool Style::drawMenuBarItemControl(const QStyleOption *option, QPainter *painter
     bool sunken(enabled && (state & State_Sunken));
     bool useStrongFocus(Graceful::Config::MenuItemDrawStrongFocus);
 
-    painter->save();
-    painter->setRenderHint(QPainter::Antialiasing, false);
+    {
+        PainterStateGuard guard(painter, PainterStateGuard::RenderHints | PainterStateGuard::Brush | PainterStateGuard::Pen);
+        painter->setRenderHint(QPainter::Antialiasing, false);
 
-    painter->setBrush(palette.window().color());
-    painter->setPen(Qt::NoPen);
-    painter->drawRect(rect);
+        painter->setBrush(palette.window().color());
+        painter->setPen(Qt::NoPen);
+        painter->drawRect(rect);
 
-    painter->setBrush(Qt::NoBrush);
-    painter->setPen(Colors::mix(palette.color(QPalette::Window), palette.color(QPalette::Shadow), 0.2));
+        painter->setBrush(Qt::NoBrush);
+        painter->setPen(Colors::mix(palette.color(QPalette::Window), palette.color(QPalette::Shadow), 0.2));
 
-    painter->drawLine(rect.bottomLeft(), rect.bottomRight());
-    painter->restore();
+        painter->drawLine(rect.bottomLeft(), rect.bottomRight());
+    }
 
     // render hover and focus
     if (useStrongFocus && sunken) {
-        QColor outlineColor = Colors::focusColor(StyleOptions(palette));
+        QColor outlineColor = Colors::focusColor(PaintOptions(palette));
         _helper->renderFocusRect(painter, QRect(rect.left(), rect.bottom() - 2, rect.width(), 3), outlineColor);
     }
 
@@ -5186,7 +5234,7 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
         // normal separator
         if (menuItemOption->text.isEmpty() && menuItemOption->icon.isNull()) {
             // Style options
-            StyleOptions styleOptions(option->palette);
+            PaintOptions styleOptions(option->palette);
             styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
             QColor color(Colors::separatorColor(styleOptions));
@@ -5216,7 +5264,7 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
 
     // render hover and focus
     if (useStrongFocus && (selected || sunken)) {
-        QColor color = Colors::focusColor(StyleOptions(palette));
+        QColor color = Colors::focusColor(PaintOptions(palette));
         QColor outlineColor = Qt::transparent;
 
         Sides sides = 0;
@@ -5239,7 +5287,7 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
     CheckBoxState checkState(menuItemOption->checked ? CheckOn : CheckOff);
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(false);
     styleOptions.setSunken(false);
@@ -5342,9 +5390,9 @@ bool Style::drawMenuItemControl(const QStyleOption *option, QPainter *painter, c
         if (useStrongFocus && (selected || sunken)) {
             arrowColor = palette.color(QPalette::HighlightedText);
         } else if (sunken) {
-            arrowColor = Colors::focusColor(StyleOptions(palette));
+            arrowColor = Colors::focusColor(PaintOptions(palette));
         } else if (selected) {
-            arrowColor = Colors::hoverColor(StyleOptions(palette));
+            arrowColor = Colors::hoverColor(PaintOptions(palette));
         } else {
             styleOptions.setColorRole(QPalette::WindowText);
             arrowColor = Colors::arrowOutlineColor(styleOptions);
@@ -5500,7 +5548,7 @@ bool Style::drawProgressBarGrooveControl(const QStyleOption *option, QPainter *p
     const QPalette &palette(option->palette);
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setHasFocus(false);
     styleOptions.setSunken(false);
     styleOptions.setOpacity(AnimationData::OpacityInvalid);
@@ -5583,7 +5631,7 @@ bool Style::drawScrollBarSliderControl(const QStyleOption *option, QPainter *pai
     qreal opacity(_animations->scrollBarEngine().opacity(widget, SC_ScrollBarSlider));
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(hasFocus);
     styleOptions.setSunken(sunken);
@@ -5776,7 +5824,7 @@ bool Style::drawShapedFrameControl(const QStyleOption *option, QPainter *painter
         const QRect &rect(option->rect);
 
         // Style options
-        StyleOptions styleOptions(option->palette);
+        PaintOptions styleOptions(option->palette);
         styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
         QColor color(Colors::separatorColor(styleOptions));
@@ -5912,7 +5960,7 @@ bool Style::drawHeaderLabelControl(const QStyleOption *option, QPainter *painter
         QPalette palette(header->palette);
 
         // Style options
-        StyleOptions styleOptions(option->palette);
+        PaintOptions styleOptions(option->palette);
         styleOptions.setState(header->state);
 
         palette.setColor(QPalette::Text, Colors::headerTextColor(styleOptions));
@@ -6067,9 +6115,9 @@ bool Style::drawTabBarTabLabelControl(const QStyleOption *option, QPainter *pain
     // text rect
     QRect textRect(subElementRect(SE_TabBarTabText, option, widget));
 
+    // properly rotate painter
+    PainterStateGuard guard(painter, verticalTabs ? PainterStateGuard::Transform : PainterStateGuard::None);
     if (verticalTabs) {
-        // properly rotate painter
-        painter->save();
         int newX, newY, newRot;
         if (tabOption->shape == QTabBar::RoundedEast || tabOption->shape == QTabBar::TriangularEast) {
             newX = rect.width() + rect.x();
@@ -6090,10 +6138,6 @@ bool Style::drawTabBarTabLabelControl(const QStyleOption *option, QPainter *pain
     // adjust text rect based on font metrics
     textRect = option->fontMetrics.boundingRect(textRect, textFlags, tabOption->text);
 
-    if (verticalTabs) {
-        painter->restore();
-    }
-
     return true;
 }
 
@@ -6181,16 +6225,16 @@ bool Style::drawTabBarTabShapeControl(const QStyleOption *option, QPainter *pain
     }
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setState(option->state);
 
     // underline
-    QColor underline(enabled && selected ? Colors::focusColor(StyleOptions(palette)) : selected || mouseOver ? option->palette.color(QPalette::Window).darker() : Qt::transparent);
+    QColor underline(enabled && selected ? Colors::focusColor(PaintOptions(palette)) : selected || mouseOver ? option->palette.color(QPalette::Window).darker() : Qt::transparent);
 
     // outline
     QColor outline = QColor();
     if (selected && widget && widget->property("movable").toBool()) {
-        outline = Colors::frameOutlineColor(StyleOptions(palette));
+        outline = Colors::frameOutlineColor(PaintOptions(palette));
     }
 
     // background
@@ -6318,7 +6362,7 @@ bool Style::drawToolBoxTabShapeControl(const QStyleOption *option, QPainter *pai
     }
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(false);
     styleOptions.setOpacity(opacity);
@@ -6327,7 +6371,7 @@ bool Style::drawToolBoxTabShapeControl(const QStyleOption *option, QPainter *pai
     // color
     QColor outline;
     if (selected) {
-        outline = Colors::focusColor(StyleOptions(palette));
+        outline = Colors::focusColor(PaintOptions(palette));
     } else {
         outline = Colors::frameOutlineColor(styleOptions);
     }
@@ -6388,12 +6432,11 @@ bool Style::drawDockWidgetTitleControl(const QStyleOption *option, QPainter *pai
         size.transpose();
         rect.setSize(size);
 
-        painter->save();
+        PainterStateGuard guard(painter, PainterStateGuard::Pen | PainterStateGuard::Transform);
         painter->translate(rect.left(), rect.top() + rect.width());
         painter->rotate(-90);
         painter->translate(-rect.left(), -rect.top());
         drawItemText(painter, rect, Qt::AlignLeft | Qt::AlignVCenter | _mnemonics->textFlags(), palette, enabled, title, QPalette::WindowText);
-        painter->restore();
     } else {
         drawItemText(painter, rect, Qt::AlignLeft | Qt::AlignVCenter | _mnemonics->textFlags(), palette, enabled, title, QPalette::WindowText);
     }
@@ -6523,7 +6566,7 @@ bool Style::drawToolButtonComplexControl(const QStyleOptionComplex *option, QPai
             QColor background(Colors::mix(option->palette.window().color(), option->palette.shadow().color(), 0.15));
             background = Colors::mix(background, Qt::white, 0.2 * mouseOpacity);
             background = Colors::mix(background, Qt::black, 0.15 * pressedOpacity);
-            QColor outline(Colors::frameOutlineColor(StyleOptions(option->palette)));
+            QColor outline(Colors::frameOutlineColor(PaintOptions(option->palette)));
             painter->setPen(background);
             painter->setBrush(background);
             switch (toolButtonOption->arrowType) {
@@ -6663,7 +6706,7 @@ bool Style::drawComboBoxComplexControl(const QStyleOptionComplex *option, QPaint
     _animations->inputWidgetEngine().updateState(widget, AnimationFocus, hasFocus && !mouseOver);
 
     // Style options
-    StyleOptions styleOptions(option->palette);
+    PaintOptions styleOptions(option->palette);
     styleOptions.setMouseOver(mouseOver);
     styleOptions.setHasFocus(hasFocus);
     styleOptions.setSunken(sunken);
@@ -6856,7 +6899,7 @@ bool Style::drawSliderComplexControl(const QStyleOptionComplex *option, QPainter
             }
 
             // Style options
-            StyleOptions styleOptions(palette);
+            PaintOptions styleOptions(palette);
             styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
             // colors
@@ -6898,7 +6941,7 @@ bool Style::drawSliderComplexControl(const QStyleOptionComplex *option, QPainter
         QRect grooveRect(subControlRect(CC_Slider, sliderOption, SC_SliderGroove, widget));
 
         // Style options
-        StyleOptions styleOptions(palette);
+        PaintOptions styleOptions(palette);
         styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
         // base color
@@ -6961,7 +7004,7 @@ bool Style::drawSliderComplexControl(const QStyleOptionComplex *option, QPainter
         qreal opacity(_animations->widgetStateEngine().buttonOpacity(widget));
 
         // Style options
-        StyleOptions styleOptions(palette);
+        PaintOptions styleOptions(palette);
         styleOptions.setMouseOver(mouseOver);
         styleOptions.setOpacity(opacity);
         styleOptions.setCheckboxState(CheckOff);
@@ -7058,7 +7101,7 @@ bool Style::drawDialComplexControl(const QStyleOptionComplex *option, QPainter *
         qreal opacity(_animations->dialEngine().buttonOpacity(widget));
 
         // Style options
-        StyleOptions styleOptions(palette);
+        PaintOptions styleOptions(palette);
         styleOptions.setAnimationMode(mode);
         styleOptions.setMouseOver(handleActive && mouseOver);
         styleOptions.setHasFocus(hasFocus);
@@ -7168,7 +7211,7 @@ bool Style::drawTitleBarComplexControl(const QStyleOptionComplex *option, QPaint
     bool active(enabled && (titleBarOption->titleBarState & Qt::WindowActive));
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setActive(active);
     styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
@@ -7285,7 +7328,7 @@ void Style::renderSpinBoxArrow(const SubControl &subControl, const QStyleOptionS
     bool hasFocus(state & State_HasFocus);
     bool enabled(state & State_Enabled);
     bool sunken(state & State_Sunken && option->activeSubControls & subControl);
-    const QColor &outline = Colors::frameOutlineColor(StyleOptions(palette)).lighter(120);
+    const QColor &outline = Colors::frameOutlineColor(PaintOptions(palette)).lighter(120);
 
     // check steps enable step
     const bool atLimit((subControl == SC_SpinBoxUp && !(option->stepEnabled & QAbstractSpinBox::StepUpEnabled))
@@ -7307,7 +7350,7 @@ void Style::renderSpinBoxArrow(const SubControl &subControl, const QStyleOptionS
     qreal pressedOpacity(_animations->spinBoxEngine().pressed(widget, subControl));
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setColorRole(QPalette::Text);
 
     QColor color = Colors::arrowOutlineColor(styleOptions);
@@ -7360,7 +7403,7 @@ void Style::renderMenuTitle(const QStyleOptionToolButton *option, QPainter *pain
     const QPalette &palette(option->palette);
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setColorVariant(_dark ? Graceful::ColorVariant::GracefulDark : Graceful::ColorVariant::Graceful);
 
     QColor color(Colors::separatorColor(styleOptions));
@@ -7426,7 +7469,7 @@ QColor Style::scrollBarArrowColor(const QStyleOptionSlider *option, const SubCon
     const QPalette &palette(option->palette);
 
     // Style options
-    StyleOptions styleOptions(palette);
+    PaintOptions styleOptions(palette);
     styleOptions.setColorRole(QPalette::WindowText);
 
     QColor color(Colors::arrowOutlineColor(styleOptions));
@@ -7488,7 +7531,7 @@ QColor Style::scrollBarArrowColor(const QStyleOptionSlider *option, const SubCon
     }
 
     if (rect.intersects(_animations->scrollBarEngine().subControlRect(widget, control))) {
-        QColor highlight = Colors::hoverColor(StyleOptions(palette));
+        QColor highlight = Colors::hoverColor(PaintOptions(palette));
         if (animated) {
             color = Colors::mix(color, highlight, opacity);
         } else if (mouseOver) {
@@ -7571,58 +7614,28 @@ QIcon Style::toolBarExtensionIcon(StandardPixmap standardPixmap, const QStyleOpt
         palette = QApplication::palette();
     }
 
-    // convenience class to map color to icon mode
-    struct IconData {
-        QColor _color;
-        QIcon::Mode _mode;
-        QIcon::State _state;
-    };
-
     // map colors to icon states
-    const QList<IconData> iconTypes = {
-        { palette.color(QPalette::Active, QPalette::WindowText), QIcon::Normal, QIcon::Off },
-        { palette.color(QPalette::Active, QPalette::WindowText), QIcon::Selected, QIcon::Off },
-        { palette.color(QPalette::Active, QPalette::WindowText), QIcon::Active, QIcon::Off },
-        { palette.color(QPalette::Disabled, QPalette::WindowText), QIcon::Disabled, QIcon::Off },
-
-        { palette.color(QPalette::Active, QPalette::HighlightedText), QIcon::Normal, QIcon::On },
-        { palette.color(QPalette::Active, QPalette::HighlightedText), QIcon::Selected, QIcon::On },
-        { palette.color(QPalette::Active, QPalette::WindowText), QIcon::Active, QIcon::On },
-        { palette.color(QPalette::Disabled, QPalette::WindowText), QIcon::Disabled, QIcon::On }
+    const IconEngine::IconDataList iconTypes = {
+        { palette.color(QPalette::Active, QPalette::WindowText), false, QIcon::Normal, QIcon::Off },
+        { palette.color(QPalette::Active, QPalette::WindowText), false, QIcon::Selected, QIcon::Off },
+        { palette.color(QPalette::Active, QPalette::WindowText), false, QIcon::Active, QIcon::Off },
+        { palette.color(QPalette::Disabled, QPalette::WindowText), false, QIcon::Disabled, QIcon::Off },
+
+        { palette.color(QPalette::Active, QPalette::HighlightedText), false, QIcon::Normal, QIcon::On },
+        { palette.color(QPalette::Active, QPalette::HighlightedText), false, QIcon::Selected, QIcon::On },
+        { palette.color(QPalette::Active, QPalette::WindowText), false, QIcon::Active, QIcon::On },
+        { palette.color(QPalette::Disabled, QPalette::WindowText), false, QIcon::Disabled, QIcon::On }
     };
 
-    // default icon sizes
-    static const QList<int> iconSizes = { 8, 16, 22, 32, 48 };
-
     // decide arrow orientation
     ArrowOrientation orientation(standardPixmap == SP_ToolBarHorizontalExtensionButton ? ArrowRight : ArrowDown);
+    QPoint offset(standardPixmap == SP_ToolBarHorizontalExtensionButton ? QPoint(1, 0) : QPoint(0, 1));
 
-    // create icon and fill
-    QIcon icon;
-    for (auto iconData = iconTypes.constBegin(); iconData != iconTypes.constEnd(); ++iconData) {
-        for (auto iconSize = iconSizes.constBegin(); iconSize != iconSizes.constEnd(); ++ iconSize) {
-            // create pixmap
-            QPixmap pixmap((*iconSize), (*iconSize));
-            pixmap.fill(Qt::transparent);
-
-            // render
-            QPainter painter(&pixmap);
-
-            // icon size
-            int fixedIconSize(pixelMetric(QStyle::PM_SmallIconSize, option, widget));
-            QRect fixedRect(0, 0, fixedIconSize, fixedIconSize);
-
-            painter.setWindow(fixedRect);
-            painter.translate(standardPixmap == SP_ToolBarHorizontalExtensionButton ? QPoint(1, 0) : QPoint(0, 1));
-            _helper->renderArrow(&painter, fixedRect, (*iconData)._color, orientation);
-            painter.end();
-
-            // add to icon
-            icon.addPixmap(pixmap, (*iconData)._mode, (*iconData)._state);
-        }
-    }
+    // icon size
+    int fixedIconSize(pixelMetric(QStyle::PM_SmallIconSize, option, widget));
 
-    return icon;
+    // pixmaps are rendered on request, for the exact size and device pixel ratio
+    return QIcon(new IconEngine(_helper, orientation, fixedIconSize, offset, iconTypes));
 }
 
 //____________________________________________________________________________________
@@ -7665,21 +7678,13 @@ QIcon Style::titleBarButtonIcon(StandardPixmap standardPixmap, const QStyleOptio
     palette.setCurrentColorGroup(QPalette::Active);
     QColor base(palette.color(QPalette::WindowText));
     QColor selected(palette.color(QPalette::HighlightedText));
-    QColor negative(buttonType == ButtonClose ? Colors::negativeText(StyleOptions(palette)) : base);
-    QColor negativeSelected(buttonType == ButtonClose ? Colors::negativeText(StyleOptions(palette)) : selected);
+    QColor negative(buttonType == ButtonClose ? Colors::negativeText(PaintOptions(palette)) : base);
+    QColor negativeSelected(buttonType == ButtonClose ? Colors::negativeText(PaintOptions(palette)) : selected);
 
     bool invertNormalState(isCloseButton);
 
-    // convenience class to map color to icon mode
-    struct IconData {
-        QColor _color;
-        bool _inverted;
-        QIcon::Mode _mode;
-        QIcon::State _state;
-    };
-
     // map colors to icon states
-    const QList<IconData> iconTypes = {
+    const IconEngine::IconDataList iconTypes = {
         // state off icons
         { Colors::mix(palette.color(QPalette::Window), base,  0.5), invertNormalState, QIcon::Normal, QIcon::Off },
         { Colors::mix(palette.color(QPalette::Window), selected, 0.5), invertNormalState, QIcon::Selected, QIcon::Off },
@@ -7693,30 +7698,8 @@ QIcon Style::titleBarButtonIcon(StandardPixmap standardPixmap, const QStyleOptio
         { Colors::mix(palette.color(QPalette::Window), base, 0.2), invertNormalState, QIcon::Disabled, QIcon::On }
     };
 
-    // default icon sizes
-    static const QList<int> iconSizes = { 8, 16, 22, 32, 48 };
-
-    // output icon
-    QIcon icon;
-
-    for (auto iconData = iconTypes.constBegin(); iconData != iconTypes.constEnd(); ++iconData) {
-        for (auto iconSize = iconSizes.constBegin(); iconSize != iconSizes.constEnd(); ++iconSize) {
-            // create pixmap
-            QPixmap pixmap(*iconSize, *iconSize);
-            pixmap.fill(Qt::transparent);
-
-            // create painter and render
-            QPainter painter(&pixmap);
-            _helper->renderDecorationButton(&painter, pixmap.rect(), (*iconData)._color, buttonType, (*iconData)._inverted);
-
-            painter.end();
-
-            // store
-            icon.addPixmap(pixmap, (*iconData)._mode, (*iconData)._state);
-        }
-    }
-
-    return icon;
+    // pixmaps are rendered on request, for the exact size and device pixel ratio
+    return QIcon(new IconEngine(_helper, buttonType, iconTypes));
 }
 
 //______________________________________________________________________________
@@ -2,12 +2,15 @@
 #define GRACEFUL_GRACEFULSTYLE_H
 #include "graceful.h"
 #include "csyslog.h"
+#include "graceful-pixmap-cache.h"
 
 #include <QHash>
 #include <QIcon>
+#include <QCache>
 #include <QWidget>
 #include <QDockWidget>
 #include <QCommonStyle>
+#include <QSharedPointer>
 #include <QStyleOption>
 #include <QMdiSubWindow>
 #include <QAbstractItemView>
@@ -397,8 +400,8 @@ private:
     ScrollBarButtonType _subLineButtons;
     //@}
 
-    //* helper
-    Helper *_helper;
+    //* helper. Shared with the icon engines, which can outlive the style
+    QSharedPointer<Helper> _helper;
 
     //* animations
     Animations *_animations;
@@ -418,9 +421,15 @@ private:
     //* tabbar data
     GracefulPrivate::TabBarData *_tabBarData;
 
-    //* icon hash
-    using IconCache = QHash<StandardPixmap, QIcon>;
-    IconCache _iconCache;
+    //* icon cache, keyed by standard pixmap, palette and color variant.
+    //* Icons only hold their engine, whose pixmaps are charged to Helper::iconPixmapCache
+    using IconCache = QCache<CacheKey, QIcon>;
+    mutable IconCache _iconCache;
+
+    //* palettes blended for enable/disable transitions, keyed by source palette and ratio.
+    //* Palettes hold no pixels, so that they are bounded in number rather than charged to PixmapBudget
+    using PaletteCache = QCache<CacheKey, QPalette>;
+    mutable PaletteCache _disabledPaletteCache;
 
     //* pointer to primitive specialized function
     using StylePrimitive = bool(Style::*)(const QStyleOption *option, QPainter *painter, const QWidget *widget) const;
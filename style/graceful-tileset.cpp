@@ -0,0 +1,87 @@
+#include "graceful-tileset.h"
+
+#include <QPainter>
+
+namespace Graceful
+{
+//______________________________________________________________________________
+TileSet::TileSet(const QPixmap &source, int w1, int h1, const QColor &center) : _center(center), _w1(w1), _h1(h1)
+{
+    // all slicing is done in device pixels
+    qreal dpiRatio(source.devicePixelRatio());
+    int dw1(qRound(w1 * dpiRatio));
+    int dh1(qRound(h1 * dpiRatio));
+    int dw2(qRound(dpiRatio));
+    int dh2(qRound(dpiRatio));
+
+    if (source.width() < 2 * dw1 + dw2 || source.height() < 2 * dh1 + dh2)
+        return;
+
+    int x2(source.width() - dw1);
+    int y2(source.height() - dh1);
+    QRect rects[8] = {QRect(0, 0, dw1, dh1),
+                      QRect(dw1, 0, dw2, dh1),
+                      QRect(x2, 0, dw1, dh1),
+                      QRect(0, dh1, dw1, dh2),
+                      QRect(x2, dh1, dw1, dh2),
+                      QRect(0, y2, dw1, dh1),
+                      QRect(dw1, y2, dw2, dh1),
+                      QRect(x2, y2, dw1, dh1)};
+
+    _pixmaps.reserve(8);
+    for (int i = 0; i < 8; ++i) {
+        QPixmap pixmap(source.copy(rects[i]));
+        pixmap.setDevicePixelRatio(dpiRatio);
+        _pixmaps.append(pixmap);
+    }
+}
+
+//______________________________________________________________________________
+void TileSet::render(const QRect &rect, QPainter *painter) const
+{
+    if (!isValid())
+        return;
+
+    // edges
+    int x0(rect.left());
+    int x1(x0 + _w1);
+    int x2(rect.right() + 1 - _w1);
+    int y0(rect.top());
+    int y1(y0 + _h1);
+    int y2(rect.bottom() + 1 - _h1);
+    int w(x2 - x1);
+    int h(y2 - y1);
+
+    // corners
+    painter->drawPixmap(x0, y0, _pixmaps.at(0));
+    painter->drawPixmap(x2, y0, _pixmaps.at(2));
+    painter->drawPixmap(x0, y2, _pixmaps.at(5));
+    painter->drawPixmap(x2, y2, _pixmaps.at(7));
+
+    // sides
+    if (w > 0) {
+        painter->drawTiledPixmap(x1, y0, w, _h1, _pixmaps.at(1));
+        painter->drawTiledPixmap(x1, y2, w, _h1, _pixmaps.at(6));
+    }
+
+    if (h > 0) {
+        painter->drawTiledPixmap(x0, y1, _w1, h, _pixmaps.at(3));
+        painter->drawTiledPixmap(x2, y1, _w1, h, _pixmaps.at(4));
+    }
+
+    // center
+    if (w > 0 && h > 0 && _center.isValid())
+        painter->fillRect(x1, y1, w, h, _center);
+}
+
+//______________________________________________________________________________
+qint64 TileSet::cost() const
+{
+    qint64 bytes(0);
+    for (auto pixmap = _pixmaps.constBegin(); pixmap != _pixmaps.constEnd(); ++pixmap)
+        bytes += qint64(pixmap->width()) * pixmap->height() * 4;
+
+    return bytes;
+}
+
+} // namespace Graceful
@@ -0,0 +1,70 @@
+#ifndef GRACEFUL_TILESET_H
+#define GRACEFUL_TILESET_H
+
+#include <QRect>
+#include <QColor>
+#include <QVector>
+#include <QPixmap>
+
+class QPainter;
+
+namespace Graceful
+{
+//* nine-slice frame. Corners are blitted, edges tiled and the center filled with a solid color
+class TileSet
+{
+public:
+    //* empty tileset
+    TileSet() : _w1(0), _h1(0)
+    {
+    }
+
+    /**
+     * create tileset from source pixmap.
+     * w1 and h1 are the logical width and height of the corners, the remaining
+     * middle row and column of the source, one logical pixel wide, is repeated along the edges.
+     * Center is filled with given color, left empty if the color is invalid
+     */
+    TileSet(const QPixmap &source, int w1, int h1, const QColor &center);
+
+    //* validity
+    bool isValid() const
+    {
+        return _pixmaps.size() == 8;
+    }
+
+    //* smallest rect that can be rendered
+    QSize minimumSize() const
+    {
+        return QSize(2 * _w1 + 1, 2 * _h1 + 1);
+    }
+
+    //* render tileset in given rect. Rect must be at least minimumSize
+    void render(const QRect &rect, QPainter *painter) const;
+
+    //* memory cost, in bytes
+    qint64 cost() const;
+
+private:
+    //* tiles, in order top-left, top, top-right, left, right, bottom-left, bottom, bottom-right
+    QVector<QPixmap> _pixmaps;
+
+    //* center color
+    QColor _center;
+
+    //* corner width
+    int _w1;
+
+    //* corner height
+    int _h1;
+};
+
+//* cost of a cached tileset, in bytes
+inline qint64 cacheCost(const TileSet &tileSet)
+{
+    return tileSet.cost();
+}
+
+} // namespace Graceful
+
+#endif // GRACEFUL_TILESET_H
@@ -33,12 +33,18 @@ include($$PWD/widget/widget.pri)
 HEADERS             += \
     $$PWD/graceful-style.h                                  \
     $$PWD/graceful-helper.h                                 \
+    $$PWD/graceful-tileset.h                                \
+    $$PWD/graceful-icon-engine.h                            \
+    $$PWD/graceful-pixmap-cache.h                           \
+    $$PWD/graceful-painter-state-guard.h                    \
     $$PWD/graceful-style-plugin.h                           \
 
 
 SOURCES             += \
     $$PWD/graceful-style.cpp                                \
     $$PWD/graceful-helper.cpp                               \
+    $$PWD/graceful-tileset.cpp                              \
+    $$PWD/graceful-icon-engine.cpp                          \
     $$PWD/graceful-style-plugin.cpp                         \
 
 
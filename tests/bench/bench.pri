@@ -0,0 +1,6 @@
+include($$PWD/../tests.pri)
+
+
+# benchmarks are run by hand, not by make check
+CONFIG              -= \
+    testcase                                                \
@@ -0,0 +1,8 @@
+TEMPLATE            = subdirs
+
+SUBDIRS             += \
+    datamap                                                 \
+    widget-state-memory                                     \
+    painter-state                                           \
+    gradient-brush                                          \
+    color-scheme                                            \
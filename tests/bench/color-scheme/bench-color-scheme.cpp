@@ -0,0 +1,267 @@
+#include "graceful.h"
+#include "graceful-colors.h"
+
+#include <QTest>
+
+using namespace Graceful;
+
+//* colors as derived on every call, before ColorScheme
+namespace Previous
+{
+
+static QColor buttonBackgroundColor(const PaintOptions &options)
+{
+
+    bool isDisabled = options.currentColorGroup() == QPalette::Disabled;
+    QColor buttonBackground(options.color(QPalette::Button));
+    QColor background(options.color(QPalette::Window));
+
+    ColorVariant variant = options.colorVariant();
+
+    if (variant == ColorVariant::Unknown) {
+        variant = Colors::isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
+    }
+
+    const bool darkMode = variant == ColorVariant::GracefulDark;
+
+    if (isDisabled && (options.animationMode() == AnimationPressed || options.sunken())) {
+        return darkMode ? Colors::darken(Colors::mix(options.color(QPalette::Active, QPalette::Window), options.color(QPalette::Active, QPalette::Base), 0.15), 0.06) :
+               Colors::darken(Colors::mix(options.color(QPalette::Active, QPalette::Window), options.color(QPalette::Active, QPalette::Base), 0.15), 0.08);
+    }
+
+    if (options.animationMode() == AnimationPressed) {
+        if (darkMode) {
+            return Colors::mix(Colors::darken(background, 0.01), Colors::darken(background, 0.09), options.opacity());
+        } else {
+            return Colors::mix(buttonBackground, Colors::darken(background, 0.14), options.opacity());
+        }
+    } else if (options.sunken()) {
+        if (darkMode) {
+            return Colors::darken(background, 0.09);
+        } else {
+            return Colors::darken(background, 0.14);
+        }
+    } else if (options.animationMode() == AnimationHover) {
+        if (darkMode) {
+            return Colors::mix(buttonBackground, Colors::darken(background, 0.01), options.opacity());
+        } else {
+            return Colors::mix(buttonBackground, background, options.opacity());
+        }
+    } else if (options.mouseOver()) {
+        if (darkMode) {
+            return Colors::darken(background, 0.01);
+        } else {
+            return background;
+        }
+    }
+
+    return buttonBackground;
+}
+
+static QColor scrollBarHandleColor(const PaintOptions &options)
+{
+
+    ColorVariant variant = options.colorVariant();
+
+    if (variant == ColorVariant::Unknown) {
+        variant = Colors::isDarkMode() ? ColorVariant::GracefulDark : ColorVariant::Graceful;
+    }
+
+    QColor fgColor = options.color(QPalette::Text);
+    QColor bgColor = options.color(QPalette::Window);
+    QColor selectedBgColor = options.color(QPalette::Highlight);
+
+    QColor color(Colors::mix(fgColor, bgColor, 0.4));
+    QColor hoverColor(Colors::mix(fgColor, bgColor, 0.2));
+    QColor activeColor(variant == ColorVariant::GracefulDark ? Colors::lighten(selectedBgColor, 0.1) : Colors::darken(selectedBgColor, 0.1));
+
+    if (options.animationMode() == AnimationPressed) {
+        if (options.mouseOver()) {
+            color = Colors::mix(hoverColor, activeColor, options.opacity());
+        } else {
+            color = Colors::mix(color, activeColor, options.opacity());
+        }
+    } else if (options.sunken()) {
+        color = activeColor;
+    } else if (options.animationMode() == AnimationHover) {
+        color = Colors::mix(color, hoverColor, options.opacity());
+    } else if (options.mouseOver()) {
+        color = hoverColor;
+    }
+
+    return color;
+}
+
+}
+
+/**
+ * per call cost of the derived colors used on the paint path,
+ * looked up from the shared ColorScheme against derived on every call as before
+ */
+class BenchColorScheme : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    //* both give the same colors, including animated states that go through color ramps
+    void sameColors_data();
+    void sameColors();
+
+    void previousButtonBackground_data();
+    void previousButtonBackground();
+
+    void buttonBackground_data();
+    void buttonBackground();
+
+    void previousScrollBarHandle_data();
+    void previousScrollBarHandle();
+
+    void scrollBarHandle_data();
+    void scrollBarHandle();
+
+private:
+    //* variants and states
+    void addStates();
+
+    //* paint options for current row
+    PaintOptions options() const;
+
+    //* palette, which paint options refer to
+    QPalette _palette;
+};
+
+//* number of calls per iteration
+static const int callCount = 1000;
+
+//____________________________________________________________
+void BenchColorScheme::addStates()
+{
+
+    QTest::addColumn<int>("variant");
+    QTest::addColumn<int>("mode");
+    QTest::addColumn<bool>("mouseOver");
+    QTest::addColumn<bool>("sunken");
+
+    const ColorVariant variants[] = { ColorVariant::Graceful, ColorVariant::GracefulDark };
+    for (const ColorVariant *variant = variants; variant != variants + 2; ++variant) {
+        const char *name(*variant == ColorVariant::GracefulDark ? "dark" : "light");
+        QTest::addRow("%s normal", name) << int(*variant) << int(AnimationNone) << false << false;
+        QTest::addRow("%s hover", name) << int(*variant) << int(AnimationNone) << true << false;
+        QTest::addRow("%s sunken", name) << int(*variant) << int(AnimationNone) << true << true;
+        QTest::addRow("%s hover animation", name) << int(*variant) << int(AnimationHover) << true << false;
+    }
+}
+
+//____________________________________________________________
+PaintOptions BenchColorScheme::options() const
+{
+
+    QFETCH(int, variant);
+    QFETCH(int, mode);
+    QFETCH(bool, mouseOver);
+    QFETCH(bool, sunken);
+
+    PaintOptions options(_palette);
+    options.setColorVariant(ColorVariant(variant));
+    options.setAnimationMode(AnimationMode(mode));
+    options.setMouseOver(mouseOver);
+    options.setSunken(sunken);
+    options.setOpacity(0.5);
+    return options;
+}
+
+//____________________________________________________________
+void BenchColorScheme::sameColors_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchColorScheme::sameColors()
+{
+
+    const PaintOptions options(this->options());
+    QCOMPARE(Colors::buttonBackgroundColor(options), Previous::buttonBackgroundColor(options));
+    QCOMPARE(Colors::scrollBarHandleColor(options), Previous::scrollBarHandleColor(options));
+}
+
+//____________________________________________________________
+void BenchColorScheme::previousButtonBackground_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchColorScheme::previousButtonBackground()
+{
+
+    const PaintOptions options(this->options());
+    QBENCHMARK {
+        for (int i = 0; i < callCount; ++i) {
+            Previous::buttonBackgroundColor(options);
+        }
+    }
+}
+
+//____________________________________________________________
+void BenchColorScheme::buttonBackground_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchColorScheme::buttonBackground()
+{
+
+    const PaintOptions options(this->options());
+    QBENCHMARK {
+        for (int i = 0; i < callCount; ++i) {
+            Colors::buttonBackgroundColor(options);
+        }
+    }
+}
+
+//____________________________________________________________
+void BenchColorScheme::previousScrollBarHandle_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchColorScheme::previousScrollBarHandle()
+{
+
+    const PaintOptions options(this->options());
+    QBENCHMARK {
+        for (int i = 0; i < callCount; ++i) {
+            Previous::scrollBarHandleColor(options);
+        }
+    }
+}
+
+//____________________________________________________________
+void BenchColorScheme::scrollBarHandle_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchColorScheme::scrollBarHandle()
+{
+
+    const PaintOptions options(this->options());
+    QBENCHMARK {
+        for (int i = 0; i < callCount; ++i) {
+            Colors::scrollBarHandleColor(options);
+        }
+    }
+}
+
+QTEST_MAIN(BenchColorScheme)
+
+#include "bench-color-scheme.moc"
@@ -0,0 +1,9 @@
+TEMPLATE            = app
+TARGET              = bench-color-scheme
+
+
+include($$PWD/../bench.pri)
+
+
+SOURCES             += \
+    $$PWD/bench-color-scheme.cpp                            \
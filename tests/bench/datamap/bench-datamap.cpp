@@ -0,0 +1,160 @@
+#include "graceful-datamap.h"
+
+#include <QMap>
+#include <QTest>
+#include <QVector>
+#include <QRandomGenerator>
+
+using namespace Graceful;
+
+//* minimal animation data
+class Data : public QObject
+{
+public:
+    void setEnabled(bool)
+    {
+    }
+
+    void setDuration(int)
+    {
+    }
+};
+
+/**
+ * lookup cost of the data map, against the QMap it replaced.
+ * Keys are looked up in random order, so that the last key cache hardly ever hits
+ */
+class BenchDataMap : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void dataMapLookup_data();
+    void dataMapLookup();
+
+    void qMapLookup_data();
+    void qMapLookup();
+
+private:
+    //* create given number of keys, and the order they are looked up in
+    void createKeys(int count);
+
+    //* owns keys and values
+    QObject *_owner;
+
+    //* keys
+    QVector<QObject *> _keys;
+
+    //* lookup order
+    QVector<const QObject *> _lookups;
+};
+
+//____________________________________________________________
+void BenchDataMap::init()
+{
+
+    _owner = new QObject;
+}
+
+//____________________________________________________________
+void BenchDataMap::cleanup()
+{
+
+    delete _owner;
+    _owner = nullptr;
+    _keys.clear();
+    _lookups.clear();
+}
+
+//____________________________________________________________
+void BenchDataMap::createKeys(int count)
+{
+
+    _keys.resize(count);
+    for (int i = 0; i < count; ++i) {
+        _keys[i] = new QObject(_owner);
+    }
+
+    QRandomGenerator random(count);
+    _lookups.resize(qMax(count, 1000));
+    for (int i = 0; i < _lookups.size(); ++i) {
+        _lookups[i] = _keys.at(random.bounded(count));
+    }
+}
+
+//____________________________________________________________
+void BenchDataMap::dataMapLookup_data()
+{
+
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("10k") << 10000;
+    QTest::newRow("100k") << 100000;
+}
+
+//____________________________________________________________
+void BenchDataMap::dataMapLookup()
+{
+
+    QFETCH(int, count);
+    createKeys(count);
+
+    DataMap<Data> map;
+    for (auto iter = _keys.constBegin(); iter != _keys.constEnd(); ++iter) {
+        Data *value(new Data);
+        value->setParent(_owner);
+        map.insert(*iter, value);
+    }
+
+    int found(0);
+    QBENCHMARK {
+        for (auto iter = _lookups.constBegin(); iter != _lookups.constEnd(); ++iter) {
+            if (map.find(*iter)) {
+                ++found;
+            }
+        }
+    }
+
+    QVERIFY(found > 0);
+}
+
+//____________________________________________________________
+void BenchDataMap::qMapLookup_data()
+{
+
+    dataMapLookup_data();
+}
+
+//____________________________________________________________
+void BenchDataMap::qMapLookup()
+{
+
+    QFETCH(int, count);
+    createKeys(count);
+
+    QMap<const QObject *, WeakPointer<Data> > map;
+    for (auto iter = _keys.constBegin(); iter != _keys.constEnd(); ++iter) {
+        Data *value(new Data);
+        value->setParent(_owner);
+        map.insert(*iter, value);
+    }
+
+    int found(0);
+    QBENCHMARK {
+        for (auto iter = _lookups.constBegin(); iter != _lookups.constEnd(); ++iter) {
+            if (map.value(*iter)) {
+                ++found;
+            }
+        }
+    }
+
+    QVERIFY(found > 0);
+}
+
+QTEST_MAIN(BenchDataMap)
+
+#include "bench-datamap.moc"
@@ -0,0 +1,9 @@
+TEMPLATE            = app
+TARGET              = bench-datamap
+
+
+include($$PWD/../bench.pri)
+
+
+SOURCES             += \
+    $$PWD/bench-datamap.cpp                                 \
@@ -0,0 +1,183 @@
+#include "graceful-helper.h"
+#include "graceful-colors.h"
+
+#include <QTest>
+#include <QImage>
+#include <QPainter>
+#include <QLinearGradient>
+
+using namespace Graceful;
+
+/**
+ * cost of filling a button frame with Helper::gradientBrush, against the linear gradient it replaced.
+ * Sunken and pressed buttons use the same color for both stops, and get a solid brush
+ */
+class BenchGradientBrush : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    //* both brushes render the same pixels
+    void sameOutput_data();
+    void sameOutput();
+
+    void linearGradient_data();
+    void linearGradient();
+
+    void gradientBrush_data();
+    void gradientBrush();
+
+private:
+    //* stops of the button states
+    void addStates();
+
+    //* previous brush, always a gradient
+    static QBrush linearGradient(const QPointF &start, const QPointF &finalStop, const QColor &color0, const QColor &color1);
+
+    //* fill button frame, as Helper::drawButtonFrame does
+    void fill(QPainter *painter, const QBrush &brush) const;
+
+    //* frame
+    QRectF _frameRect;
+
+    //* frame shape
+    QPainterPath _path;
+
+    //* target
+    QImage _image;
+};
+
+//* number of frames per iteration
+static const int frameCount = 100;
+
+//____________________________________________________________
+void BenchGradientBrush::init()
+{
+
+    // a typical push button
+    _frameRect = QRectF(0.5, 0.5, 95, 31);
+    _path.addRoundedRect(_frameRect, 3, 3);
+
+    _image = QImage(96, 32, QImage::Format_ARGB32_Premultiplied);
+    _image.fill(Qt::transparent);
+}
+
+//____________________________________________________________
+void BenchGradientBrush::cleanup()
+{
+
+    _path = QPainterPath();
+}
+
+//____________________________________________________________
+QBrush BenchGradientBrush::linearGradient(const QPointF &start, const QPointF &finalStop, const QColor &color0, const QColor &color1)
+{
+
+    QLinearGradient gradient(start, finalStop);
+    gradient.setColorAt(0, color0);
+    gradient.setColorAt(1, color1);
+    return QBrush(gradient);
+}
+
+//____________________________________________________________
+void BenchGradientBrush::fill(QPainter *painter, const QBrush &brush) const
+{
+
+    painter->setRenderHint(QPainter::Antialiasing, true);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(brush);
+    painter->drawPath(_path);
+}
+
+//____________________________________________________________
+void BenchGradientBrush::addStates()
+{
+
+    QTest::addColumn<QColor>("color0");
+    QTest::addColumn<QColor>("color1");
+
+    const QColor button(0xf6, 0xf5, 0xf4);
+    QTest::newRow("sunken") << button << button;
+    QTest::newRow("pressed dark") << QColor(0x3d, 0x38, 0x46) << QColor(0x3d, 0x38, 0x46);
+    QTest::newRow("normal") << Colors::darken(button, 0.05) << button;
+}
+
+//____________________________________________________________
+void BenchGradientBrush::sameOutput_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchGradientBrush::sameOutput()
+{
+
+    QFETCH(QColor, color0);
+    QFETCH(QColor, color1);
+
+    QImage reference(_image);
+    {
+        QPainter painter(&reference);
+        fill(&painter, linearGradient(_frameRect.bottomLeft(), _frameRect.topLeft(), color0, color1));
+    }
+
+    QImage image(_image);
+    {
+        QPainter painter(&image);
+        fill(&painter, Helper::gradientBrush(_frameRect.bottomLeft(), _frameRect.topLeft(), color0, color1));
+    }
+
+    QCOMPARE(image, reference);
+}
+
+//____________________________________________________________
+void BenchGradientBrush::linearGradient_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchGradientBrush::linearGradient()
+{
+
+    QFETCH(QColor, color0);
+    QFETCH(QColor, color1);
+
+    QPainter painter(&_image);
+    QBENCHMARK {
+        for (int i = 0; i < frameCount; ++i) {
+            fill(&painter, linearGradient(_frameRect.bottomLeft(), _frameRect.topLeft(), color0, color1));
+        }
+    }
+}
+
+//____________________________________________________________
+void BenchGradientBrush::gradientBrush_data()
+{
+
+    addStates();
+}
+
+//____________________________________________________________
+void BenchGradientBrush::gradientBrush()
+{
+
+    QFETCH(QColor, color0);
+    QFETCH(QColor, color1);
+
+    QPainter painter(&_image);
+    QBENCHMARK {
+        for (int i = 0; i < frameCount; ++i) {
+            fill(&painter, Helper::gradientBrush(_frameRect.bottomLeft(), _frameRect.topLeft(), color0, color1));
+        }
+    }
+}
+
+QTEST_MAIN(BenchGradientBrush)
+
+#include "bench-gradient-brush.moc"
@@ -0,0 +1,10 @@
+TEMPLATE            = app
+TARGET              = bench-gradient-brush
+
+
+include($$PWD/../bench.pri)
+include($$PWD/../../style-helper.pri)
+
+
+SOURCES             += \
+    $$PWD/bench-gradient-brush.cpp                          \
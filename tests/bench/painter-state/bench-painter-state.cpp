@@ -0,0 +1,128 @@
+#include "graceful-painter-state-guard.h"
+
+#include <QTest>
+#include <QImage>
+#include <QPainter>
+
+using namespace Graceful;
+
+/**
+ * cost of QPainter::save and restore against PainterStateGuard,
+ * around the pen, brush and antialiasing changes typical of Helper render methods.
+ * With drawing disabled, only the state handling is measured
+ */
+class BenchPainterState : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void saveRestore_data();
+    void saveRestore();
+
+    void guard_data();
+    void guard();
+
+private:
+    //* change state as a render method would, and draw if requested
+    static void render(QPainter *painter, bool draw);
+
+    //* target
+    QImage _image;
+
+    //* painter
+    QPainter *_painter;
+};
+
+//* number of render calls per iteration
+static const int renderCount = 1000;
+
+//____________________________________________________________
+void BenchPainterState::init()
+{
+
+    _image = QImage(64, 64, QImage::Format_ARGB32_Premultiplied);
+    _image.fill(Qt::transparent);
+    _painter = new QPainter(&_image);
+
+    // some state the render methods are not supposed to lose
+    _painter->setClipRect(QRect(2, 2, 60, 60));
+    _painter->setFont(QFont(QStringLiteral("Sans"), 10));
+}
+
+//____________________________________________________________
+void BenchPainterState::cleanup()
+{
+
+    delete _painter;
+    _painter = nullptr;
+}
+
+//____________________________________________________________
+void BenchPainterState::render(QPainter *painter, bool draw)
+{
+
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(QPen(QColor(0x35, 0x84, 0xe4), 1));
+    painter->setBrush(QColor(0xf6, 0xf5, 0xf4));
+
+    if (draw) {
+        painter->drawRoundedRect(QRectF(4.5, 4.5, 40, 24), 3, 3);
+    }
+}
+
+//____________________________________________________________
+void BenchPainterState::saveRestore_data()
+{
+
+    QTest::addColumn<bool>("draw");
+
+    QTest::newRow("state only") << false;
+    QTest::newRow("rounded rect") << true;
+}
+
+//____________________________________________________________
+void BenchPainterState::saveRestore()
+{
+
+    QFETCH(bool, draw);
+
+    QBENCHMARK {
+        for (int i = 0; i < renderCount; ++i) {
+            _painter->save();
+            render(_painter, draw);
+            _painter->restore();
+        }
+    }
+
+    QVERIFY(!_painter->testRenderHint(QPainter::Antialiasing));
+}
+
+//____________________________________________________________
+void BenchPainterState::guard_data()
+{
+
+    saveRestore_data();
+}
+
+//____________________________________________________________
+void BenchPainterState::guard()
+{
+
+    QFETCH(bool, draw);
+
+    QBENCHMARK {
+        for (int i = 0; i < renderCount; ++i) {
+            PainterStateGuard guard(_painter, PainterStateGuard::Pen | PainterStateGuard::Brush | PainterStateGuard::RenderHints);
+            render(_painter, draw);
+        }
+    }
+
+    QVERIFY(!_painter->testRenderHint(QPainter::Antialiasing));
+}
+
+QTEST_MAIN(BenchPainterState)
+
+#include "bench-painter-state.moc"
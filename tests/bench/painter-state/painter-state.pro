@@ -0,0 +1,13 @@
+TEMPLATE            = app
+TARGET              = bench-painter-state
+
+
+include($$PWD/../bench.pri)
+
+
+INCLUDEPATH         += \
+    $$PWD/../../../style/                                   \
+
+
+SOURCES             += \
+    $$PWD/bench-painter-state.cpp                           \
@@ -0,0 +1,142 @@
+#include "graceful-animations.h"
+#include "graceful-widget-state-data.h"
+
+#include "ui_widgetfactory.h"
+
+#include <QTest>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace Graceful;
+
+//* bytes currently allocated on the heap. Negative if unknown
+static qint64 heapBytes()
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    return qint64(mallinfo2().uordblks);
+#elif defined(__GLIBC__)
+    return qint64(mallinfo().uordblks);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * animation data kept around for the demo widget factory form.
+ * Registering widgets must not create any widget state data: it is created on the first state change only
+ */
+class BenchWidgetStateMemory : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    //* data and heap used once all widgets of the form are registered
+    void registration();
+
+    //* data and heap used once all widgets of the form have been hovered
+    void hover();
+
+private:
+    //* register all widgets of the form
+    void registerWidgets();
+
+    //* print data count and heap growth since init
+    void report(const char *step) const;
+
+    //* form
+    QWidget *_form;
+
+    //* widgets of the form
+    QList<QWidget *> _widgets;
+
+    //* animations
+    Animations *_animations;
+
+    //* heap before registration
+    qint64 _heap;
+};
+
+//____________________________________________________________
+void BenchWidgetStateMemory::init()
+{
+
+    _form = new QWidget;
+    Ui::WidgetFactory ui;
+    ui.setupUi(_form);
+    _widgets = _form->findChildren<QWidget *>();
+
+    // same setup as the style
+    _animations = new Animations(nullptr);
+    _animations->setupEngines();
+    _heap = heapBytes();
+}
+
+//____________________________________________________________
+void BenchWidgetStateMemory::cleanup()
+{
+
+    delete _animations;
+    _animations = nullptr;
+
+    delete _form;
+    _form = nullptr;
+    _widgets.clear();
+}
+
+//____________________________________________________________
+void BenchWidgetStateMemory::registerWidgets()
+{
+
+    for (auto iter = _widgets.constBegin(); iter != _widgets.constEnd(); ++iter) {
+        _animations->registerWidget(*iter);
+    }
+}
+
+//____________________________________________________________
+void BenchWidgetStateMemory::report(const char *step) const
+{
+
+    const qint64 heap(heapBytes());
+    qInfo("%s: %d widgets, %d animation data, %d widget state data, %lld heap bytes",
+          step,
+          _widgets.size(),
+          _animations->findChildren<AnimationData *>().size(),
+          _animations->findChildren<WidgetStateData *>().size(),
+          heap >= 0 && _heap >= 0 ? heap - _heap : -1);
+}
+
+//____________________________________________________________
+void BenchWidgetStateMemory::registration()
+{
+
+    registerWidgets();
+    report("registered");
+
+    QCOMPARE(_animations->findChildren<WidgetStateData *>().size(), 0);
+}
+
+//____________________________________________________________
+void BenchWidgetStateMemory::hover()
+{
+
+    registerWidgets();
+
+    // first call records the initial state, second one changes it
+    for (auto iter = _widgets.constBegin(); iter != _widgets.constEnd(); ++iter) {
+        _animations->widgetStateEngine().updateState(*iter, AnimationHover, false);
+        _animations->widgetStateEngine().updateState(*iter, AnimationHover, true);
+    }
+
+    report("hovered");
+
+    QVERIFY(_animations->findChildren<WidgetStateData *>().size() > 0);
+}
+
+QTEST_MAIN(BenchWidgetStateMemory)
+
+#include "bench-widget-state-memory.moc"
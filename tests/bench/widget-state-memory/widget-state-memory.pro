@@ -0,0 +1,13 @@
+TEMPLATE            = app
+TARGET              = bench-widget-state-memory
+
+
+include($$PWD/../bench.pri)
+
+
+SOURCES             += \
+    $$PWD/bench-widget-state-memory.cpp                     \
+
+
+FORMS               += \
+    $$PWD/../../../demo/widgetfactory.ui                    \
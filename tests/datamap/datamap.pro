@@ -0,0 +1,9 @@
+TEMPLATE            = app
+TARGET              = test-datamap
+
+
+include($$PWD/../tests.pri)
+
+
+SOURCES             += \
+    $$PWD/test-datamap.cpp                                  \
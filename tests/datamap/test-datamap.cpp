@@ -0,0 +1,202 @@
+#include "graceful-datamap.h"
+
+#include <QTest>
+#include <QVector>
+#include <QRandomGenerator>
+
+#include <map>
+
+using namespace Graceful;
+
+//* minimal animation data
+class Data : public QObject
+{
+public:
+    void setEnabled(bool)
+    {
+    }
+
+    void setDuration(int)
+    {
+    }
+};
+
+//* check the open addressing data map against std::map
+class TestDataMap : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    //* random insertions, lookups and removals give the same results as std::map
+    void randomOperations_data();
+    void randomOperations();
+
+    //* removing entries shifts back colliding ones, which must stay reachable
+    void removeAll();
+
+    //* values destroyed while registered are cleared, and their keys stay registered
+    void destroyedValue();
+
+private:
+    //* compare content and iteration
+    static void compare(DataMap<Data> &map, const std::map<const QObject *, Data *> &reference);
+};
+
+//____________________________________________________________
+void TestDataMap::compare(DataMap<Data> &map, const std::map<const QObject *, Data *> &reference)
+{
+
+    QCOMPARE(map.size(), int(reference.size()));
+    QCOMPARE(map.isEmpty(), reference.empty());
+
+    int count(0);
+    for (auto iter = map.begin(); iter != map.end(); ++iter, ++count) {
+        auto found(reference.find(iter.key()));
+        QVERIFY(found != reference.end());
+        QCOMPARE(iter.value().data(), found->second);
+    }
+
+    QCOMPARE(count, int(reference.size()));
+}
+
+//____________________________________________________________
+void TestDataMap::randomOperations_data()
+{
+
+    QTest::addColumn<int>("keys");
+    QTest::addColumn<quint32>("seed");
+
+    QTest::newRow("few keys") << 8 << quint32(1);
+    QTest::newRow("some keys") << 100 << quint32(2);
+    QTest::newRow("many keys") << 2000 << quint32(3);
+}
+
+//____________________________________________________________
+void TestDataMap::randomOperations()
+{
+
+    QFETCH(int, keys);
+    QFETCH(quint32, seed);
+
+    QRandomGenerator random(seed);
+
+    // values left over by replacements are deleted with their parent
+    QObject owner;
+    QVector<QObject *> pool(keys);
+    for (int i = 0; i < keys; ++i) {
+        pool[i] = new QObject(&owner);
+    }
+
+    DataMap<Data> map;
+    std::map<const QObject *, Data *> reference;
+
+    for (int i = 0; i < 50000; ++i) {
+        const QObject *key(pool.at(random.bounded(keys)));
+        switch (random.bounded(4)) {
+        case 0: {
+            Data *value(new Data);
+            value->setParent(&owner);
+            map.insert(key, value);
+            reference[key] = value;
+            break;
+        }
+
+        case 1: {
+            auto found(reference.find(key));
+            QCOMPARE(map.unregisterWidget(key), found != reference.end());
+            if (found != reference.end()) {
+                reference.erase(found);
+            }
+
+            break;
+        }
+
+        case 2: {
+            auto found(reference.find(key));
+            QCOMPARE(map.find(key).data(), found == reference.end() ? nullptr : found->second);
+            break;
+        }
+
+        default:
+            QCOMPARE(map.contains(key), reference.find(key) != reference.end());
+            break;
+        }
+
+        if (!(i % 5000)) {
+            compare(map, reference);
+            if (QTest::currentTestFailed()) {
+                return;
+            }
+        }
+    }
+
+    compare(map, reference);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+//____________________________________________________________
+void TestDataMap::removeAll()
+{
+
+    QObject owner;
+    QVector<QObject *> pool(1000);
+    for (int i = 0; i < pool.size(); ++i) {
+        pool[i] = new QObject(&owner);
+    }
+
+    DataMap<Data> map;
+    for (int i = 0; i < pool.size(); ++i) {
+        Data *value(new Data);
+        value->setParent(&owner);
+        map.insert(pool.at(i), value);
+    }
+
+    // remove every other key, then check the others are all still found
+    for (int i = 0; i < pool.size(); i += 2) {
+        QVERIFY(map.unregisterWidget(pool.at(i)));
+    }
+
+    for (int i = 0; i < pool.size(); ++i) {
+        QCOMPARE(map.contains(pool.at(i)), bool(i % 2));
+    }
+
+    for (int i = 1; i < pool.size(); i += 2) {
+        QVERIFY(map.unregisterWidget(pool.at(i)));
+    }
+
+    QVERIFY(map.isEmpty());
+    QVERIFY(map.begin() == map.end());
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+//____________________________________________________________
+void TestDataMap::destroyedValue()
+{
+
+    QObject key;
+    DataMap<Data> map;
+
+    // lookup also caches the value as last one
+    Data *value(new Data);
+    map.insert(&key, value);
+    QCOMPARE(map.find(&key).data(), value);
+
+    delete value;
+    QVERIFY(!map.find(&key));
+    QVERIFY(map.contains(&key));
+
+    // destroying a replaced value leaves the current one alone
+    Data *first(new Data);
+    Data *second(new Data);
+    map.insert(&key, first);
+    map.insert(&key, second);
+    delete first;
+    QCOMPARE(map.find(&key).data(), second);
+
+    QVERIFY(map.unregisterWidget(&key));
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+QTEST_MAIN(TestDataMap)
+
+#include "test-datamap.moc"
@@ -0,0 +1,9 @@
+TEMPLATE            = app
+TARGET              = test-frame-clock
+
+
+include($$PWD/../tests.pri)
+
+
+SOURCES             += \
+    $$PWD/test-frame-clock.cpp                              \
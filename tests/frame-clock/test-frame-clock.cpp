@@ -0,0 +1,111 @@
+#include "graceful-frame-clock.h"
+#include "graceful-animation.h"
+#include "graceful-tabbar-data.h"
+
+#include <QTest>
+#include <QTabBar>
+#include <QPaintEvent>
+
+using namespace Graceful;
+
+//* tabbar recording the region it is asked to repaint
+class RecordingTabBar : public QTabBar
+{
+public:
+    //* repainted region since last clear
+    QRegion _painted;
+
+protected:
+    virtual void paintEvent(QPaintEvent *event) override
+    {
+
+        _painted |= event->region();
+        QTabBar::paintEvent(event);
+    }
+};
+
+//* check that tab animations only repaint the animated tab
+class TestFrameClock : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    //* opacity changes outside of a frame repaint the tab right away
+    void opacityDamagesTabRect();
+
+    //* repaints requested while the clock advances are merged, and stay within the tab
+    void animationDamagesTabRect();
+
+private:
+    RecordingTabBar *_tabBar;
+    TabBarData *_data;
+};
+
+//____________________________________________________________
+void TestFrameClock::init()
+{
+
+    _tabBar = new RecordingTabBar;
+    _tabBar->addTab(QStringLiteral("first"));
+    _tabBar->addTab(QStringLiteral("second"));
+    _tabBar->addTab(QStringLiteral("third"));
+    _tabBar->show();
+    QVERIFY(QTest::qWaitForWindowExposed(_tabBar));
+
+    // long enough that the clock timer never finishes animations on its own
+    _data = new TabBarData(_tabBar, _tabBar, 10000);
+
+    // drop the initial paint
+    QTRY_VERIFY(!_tabBar->_painted.isEmpty());
+    _tabBar->_painted = QRegion();
+}
+
+//____________________________________________________________
+void TestFrameClock::cleanup()
+{
+
+    delete _tabBar;
+    _tabBar = nullptr;
+    _data = nullptr;
+}
+
+//____________________________________________________________
+void TestFrameClock::opacityDamagesTabRect()
+{
+
+    _data->setCurrentIndex(1);
+    _data->setCurrentOpacity(0.5);
+
+    QTRY_COMPARE(_tabBar->_painted, QRegion(_tabBar->tabRect(1)));
+}
+
+//____________________________________________________________
+void TestFrameClock::animationDamagesTabRect()
+{
+
+    FrameClock &clock(FrameClock::instance());
+    Animation *animation(_data->currentIndexAnimation().data());
+
+    _data->setCurrentIndex(1);
+    animation->start();
+    const qint64 start(clock.now());
+    QVERIFY(clock.isActive());
+
+    // tick the clock by hand rather than waiting for its timer
+    clock.advance(start + animation->duration() / 2);
+    QVERIFY(animation->isRunning());
+    QTRY_COMPARE(_tabBar->_painted, QRegion(_tabBar->tabRect(1)));
+
+    _tabBar->_painted = QRegion();
+    clock.advance(start + animation->duration());
+    QVERIFY(!animation->isRunning());
+    QVERIFY(!clock.isActive());
+    QTRY_COMPARE(_tabBar->_painted, QRegion(_tabBar->tabRect(1)));
+}
+
+QTEST_MAIN(TestFrameClock)
+
+#include "test-frame-clock.moc"
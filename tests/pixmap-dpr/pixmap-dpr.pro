@@ -0,0 +1,10 @@
+TEMPLATE            = app
+TARGET              = test-pixmap-dpr
+
+
+include($$PWD/../tests.pri)
+include($$PWD/../style-helper.pri)
+
+
+SOURCES             += \
+    $$PWD/test-pixmap-dpr.cpp                               \
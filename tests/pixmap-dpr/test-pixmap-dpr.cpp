@@ -0,0 +1,134 @@
+#include "graceful-helper.h"
+#include "graceful-pixmap-budget.h"
+
+#include <QTest>
+#include <QImage>
+#include <QtMath>
+#include <QPainter>
+
+using namespace Graceful;
+
+//* check that style pixmaps are only cached where they can be blitted without resampling
+class TestPixmapDpr : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+
+    //* button frames, frame tiles and arrows are cached at integer ratios only
+    void cachedAtIntegerRatio_data();
+    void cachedAtIntegerRatio();
+
+    //* blitting from cache gives the same pixels as the paint that filled it
+    void sameOutputFromCache_data();
+    void sameOutputFromCache();
+
+private:
+    //* ratios, and whether they allow caching
+    void addRatios();
+
+    //* paint a button frame, a frame and an arrow to an image of given ratio
+    QImage render(qreal ratio) const;
+
+    //* bytes used by given cache
+    static qint64 cacheBytes(const QString &name);
+
+    //* helper
+    Helper _helper;
+};
+
+//____________________________________________________________
+void TestPixmapDpr::init()
+{
+
+    _helper.invalidateCaches();
+}
+
+//____________________________________________________________
+void TestPixmapDpr::addRatios()
+{
+
+    QTest::addColumn<qreal>("ratio");
+    QTest::addColumn<bool>("cached");
+
+    QTest::newRow("1") << qreal(1.0) << true;
+    QTest::newRow("1.25") << qreal(1.25) << false;
+    QTest::newRow("1.5") << qreal(1.5) << false;
+    QTest::newRow("2") << qreal(2.0) << true;
+    QTest::newRow("2.5") << qreal(2.5) << false;
+}
+
+//____________________________________________________________
+QImage TestPixmapDpr::render(qreal ratio) const
+{
+
+    QImage image(qCeil(100 * ratio), qCeil(40 * ratio), QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(ratio);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    _helper.renderButtonFrame(&painter, QRect(2, 2, 60, 30), Qt::lightGray, Qt::darkGray, QColor(), false, false, false, true);
+    _helper.renderFrame(&painter, QRect(64, 2, 34, 34), Qt::white, Qt::darkGray);
+    _helper.renderArrow(&painter, QRect(10, 32, 8, 8), Qt::black, ArrowDown);
+    painter.end();
+
+    return image;
+}
+
+//____________________________________________________________
+qint64 TestPixmapDpr::cacheBytes(const QString &name)
+{
+
+    const QList<PixmapBudget::Usage> usage(PixmapBudget::instance().usage());
+    for (const PixmapBudget::Usage &cache : usage) {
+        if (cache.name == name) {
+            return cache.bytes;
+        }
+    }
+
+    return -1;
+}
+
+//____________________________________________________________
+void TestPixmapDpr::cachedAtIntegerRatio_data()
+{
+
+    addRatios();
+}
+
+//____________________________________________________________
+void TestPixmapDpr::cachedAtIntegerRatio()
+{
+
+    QFETCH(qreal, ratio);
+    QFETCH(bool, cached);
+
+    render(ratio);
+
+    QCOMPARE(cacheBytes(QStringLiteral("button frames")) > 0, cached);
+    QCOMPARE(cacheBytes(QStringLiteral("frame tiles")) > 0, cached);
+    QCOMPARE(cacheBytes(QStringLiteral("arrows")) > 0, cached);
+}
+
+//____________________________________________________________
+void TestPixmapDpr::sameOutputFromCache_data()
+{
+
+    addRatios();
+}
+
+//____________________________________________________________
+void TestPixmapDpr::sameOutputFromCache()
+{
+
+    QFETCH(qreal, ratio);
+
+    const QImage first(render(ratio));
+    const QImage second(render(ratio));
+    QCOMPARE(second, first);
+}
+
+QTEST_MAIN(TestPixmapDpr)
+
+#include "test-pixmap-dpr.moc"
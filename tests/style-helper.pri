@@ -0,0 +1,14 @@
+# style helper, built into the test itself rather than linked from the style plugin
+INCLUDEPATH         += \
+    $$PWD/../style/                                         \
+
+
+HEADERS             += \
+    $$PWD/../style/graceful-helper.h                        \
+    $$PWD/../style/graceful-tileset.h                       \
+    $$PWD/../style/graceful-pixmap-cache.h                  \
+
+
+SOURCES             += \
+    $$PWD/../style/graceful-helper.cpp                      \
+    $$PWD/../style/graceful-tileset.cpp                     \
@@ -0,0 +1,29 @@
+QT                  += \
+    gui                                                     \
+    core                                                    \
+    widgets                                                 \
+    testlib                                                 \
+
+
+CONFIG              += \
+    gnu++11                                                 \
+    testcase                                                \
+    no_keywords                                             \
+
+
+INCLUDEPATH         += \
+    $$PWD/../lib/                                           \
+    $$PWD/../lib/animations/                                \
+
+
+# libgraceful is built in the build tree, which is not the source tree in shadow builds
+GRACEFUL_LIB_DIR    = $$shadowed($$PWD/../lib)
+
+
+LIBS                += \
+    -L $$GRACEFUL_LIB_DIR                                   \
+    -lgraceful                                              \
+
+
+QMAKE_RPATHDIR      += \
+    $$GRACEFUL_LIB_DIR                                      \
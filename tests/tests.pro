@@ -0,0 +1,13 @@
+TEMPLATE            = subdirs
+
+SUBDIRS             += \
+    frame-clock                                             \
+    datamap                                                 \
+    pixmap-dpr                                              \
+
+
+# benchmarks are left out of the default build. Run qmake with CONFIG+=benchmarks to build them
+benchmarks {
+    SUBDIRS         += \
+        bench                                               \
+}